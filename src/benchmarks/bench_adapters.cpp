@@ -0,0 +1,72 @@
+// Push/pop throughput of s21::stack and s21::queue per backing container:
+// N elements pushed and popped again, then a steady state of one push and
+// one pop with N elements held.
+// usage: bench_adapters [N]
+#include <cstdio>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+
+// the element a stack or a queue pops next
+template <typename T, typename C>
+const T &next(const s21::stack<T, C> &s) {
+  return s.top();
+}
+template <typename T, typename C>
+const T &next(const s21::queue<T, C> &q) {
+  return q.front();
+}
+
+template <typename Adapter>
+void run(const char *label, std::size_t n) {
+  char name[64];
+
+  std::snprintf(name, sizeof(name), "fill/drain %s", label);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  Adapter a;
+                  for (std::size_t i = 0; i < n; ++i) a.push(int(i));
+                  long sum = 0;
+                  while (!a.empty()) {
+                    sum += next(a);
+                    a.pop();
+                  }
+                  bench::do_not_optimize(sum);
+                }),
+                2 * n);
+
+  std::snprintf(name, sizeof(name), "steady     %s", label);
+  Adapter a;
+  for (std::size_t i = 0; i < n; ++i) a.push(int(i));
+  bench::report(name, bench::best_of(kReps, [&] {
+                  long sum = 0;
+                  for (std::size_t i = 0; i < n; ++i) {
+                    a.push(int(i));
+                    sum += next(a);
+                    a.pop();
+                  }
+                  bench::do_not_optimize(sum);
+                }),
+                2 * n);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 1000000);
+  std::printf("-- stack, %zu elements\n", n);
+  run<s21::stack<int>>("vector", n);
+  run<s21::stack<int, s21::list<int>>>("list", n);
+  run<s21::stack<int, s21::deque<int>>>("deque", n);
+  run<s21::stack<int, s21::unrolled_list<int>>>("unrolled_list", n);
+  std::printf("-- queue, %zu elements\n", n);
+  run<s21::queue<int>>("ring_buffer", n);
+  run<s21::queue<int, s21::list<int>>>("list", n);
+  run<s21::queue<int, s21::deque<int>>>("deque", n);
+  run<s21::queue<int, s21::unrolled_list<int>>>("unrolled_list", n);
+  return 0;
+}
@@ -0,0 +1,134 @@
+// Producer/consumer pipeline through a bounded queue of 1024: 2 producers
+// stamp each item with the time it was pushed, 2 consumers take them one
+// by one or with pop_batch(64). s21::blocking_queue against s21::queue
+// wrapped in a mutex and a condition variable notified on every push, the
+// pattern it replaces. Reports throughput and the mean and worst
+// push-to-pop latency.
+// usage: bench_blocking_queue [N]
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+using item = clock_type::time_point;
+
+constexpr std::size_t kCapacity = 1024;
+constexpr std::size_t kBatch = 64;
+constexpr unsigned kProducers = 2, kConsumers = 2;
+
+// the hand-rolled wrapper: every push wakes a consumer
+class naive_queue {
+  std::mutex mutex_;
+  std::condition_variable not_empty_, not_full_;
+  s21::queue<item> q_;
+  bool closed_ = false;
+
+ public:
+  explicit naive_queue(std::size_t) {}
+  void push(item value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [&] { return q_.size() < kCapacity; });
+    q_.push(value);
+    not_empty_.notify_one();
+  }
+  bool pop(item &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [&] { return closed_ || !q_.empty(); });
+    if (q_.empty()) return false;
+    out = q_.front();
+    q_.pop();
+    not_full_.notify_one();
+    return true;
+  }
+  void close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    not_empty_.notify_all();
+  }
+};
+
+struct latency {
+  double total_ns = 0, worst_ns = 0;
+  std::size_t count = 0;
+
+  void add(item pushed) {
+    const double ns =
+        std::chrono::duration<double, std::nano>(clock_type::now() - pushed)
+            .count();
+    total_ns += ns;
+    if (ns > worst_ns) worst_ns = ns;
+    ++count;
+  }
+};
+
+// runs producers and consumers over q; consume(q, stats) returns once the
+// queue is closed and drained
+template <typename Queue, typename Consume>
+void run(const char *name, std::size_t n, Consume consume) {
+  Queue q(kCapacity);
+  std::vector<latency> stats(kConsumers);
+  std::vector<std::thread> producers, consumers;
+  bench::timer t;
+  for (unsigned c = 0; c < kConsumers; ++c)
+    consumers.emplace_back([&, c] {
+      bench::pin_thread(kProducers + c);
+      consume(q, stats[c]);
+    });
+  for (unsigned p = 0; p < kProducers; ++p)
+    producers.emplace_back([&, p] {
+      bench::pin_thread(p);
+      for (std::size_t i = 0; i < n / kProducers; ++i)
+        q.push(clock_type::now());
+    });
+  for (auto &thread : producers) thread.join();
+  q.close();
+  for (auto &thread : consumers) thread.join();
+  const double ms = t.ms();
+  latency all;
+  for (const latency &s : stats) {
+    all.total_ns += s.total_ns;
+    all.count += s.count;
+    if (s.worst_ns > all.worst_ns) all.worst_ns = s.worst_ns;
+  }
+  bench::report(name, ms, all.count);
+  std::printf("%-36s %10.1f us mean %10.1f us worst\n", "",
+              all.total_ns / all.count / 1000, all.worst_ns / 1000);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 2000000);
+  std::printf("-- %zu items, %u producers, %u consumers, %u CPUs\n", n,
+              kProducers, kConsumers, std::thread::hardware_concurrency());
+  run<naive_queue>("mutex + cv + s21::queue", n,
+                     [](naive_queue &q, latency &stats) {
+                       item value;
+                       while (q.pop(value)) stats.add(value);
+                     });
+  run<s21::blocking_queue<item>>(
+      "blocking_queue pop", n,
+      [](s21::blocking_queue<item> &q, latency &stats) {
+        item value;
+        while (q.pop(value) == s21::queue_op_status::success)
+          stats.add(value);
+      });
+  run<s21::blocking_queue<item>>(
+      "blocking_queue pop_batch(64)", n,
+      [](s21::blocking_queue<item> &q, latency &stats) {
+        item batch[kBatch];
+        while (std::size_t got =
+                   q.pop_batch(batch, kBatch, std::chrono::seconds(1)))
+          for (std::size_t i = 0; i < got; ++i) stats.add(batch[i]);
+      });
+  return 0;
+}
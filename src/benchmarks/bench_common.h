@@ -0,0 +1,106 @@
+#ifndef BENCHMARKS_BENCH_COMMON_H
+#define BENCHMARKS_BENCH_COMMON_H
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+// Minimal helpers shared by the benchmarks; every benchmark is a standalone
+// program built by `make bench`.
+namespace bench {
+
+// wall clock stopwatch
+class timer {
+  using clock = std::chrono::steady_clock;
+  clock::time_point start_ = clock::now();
+
+ public:
+  void reset() { start_ = clock::now(); }
+  double ms() const {
+    return std::chrono::duration<double, std::milli>(clock::now() - start_)
+        .count();
+  }
+};
+
+// peak resident set size of the calling process in KiB
+inline long peak_rss_kb() {
+  rusage ru{};
+  getrusage(RUSAGE_SELF, &ru);
+  return ru.ru_maxrss;
+}
+
+// argv[idx] as a number or the default
+inline std::size_t arg_size(int argc, char **argv, std::size_t def,
+                            int idx = 1) {
+  return argc > idx ? std::strtoull(argv[idx], nullptr, 10) : def;
+}
+
+// keeps the compiler from discarding the computation of value
+template <typename T>
+inline void do_not_optimize(const T &value) {
+  asm volatile("" : : "r"(&value) : "memory");
+}
+
+// best wall time of reps runs of fn in milliseconds
+template <typename F>
+double best_of(int reps, F &&fn) {
+  double best = 0;
+  for (int i = 0; i < reps; ++i) {
+    timer t;
+    fn();
+    const double ms = t.ms();
+    if (i == 0 || ms < best) best = ms;
+  }
+  return best;
+}
+
+// runs fn in a forked child so that time and peak RSS belong to this case
+// only; a null name leaves the reporting to fn
+template <typename F>
+void isolated(const char *name, F &&fn) {
+  std::fflush(stdout);
+  const pid_t pid = fork();
+  if (pid == 0) {
+    timer t;
+    fn();
+    const double ms = t.ms();
+    if (name != nullptr)
+      std::printf("%-36s %10.1f ms %12ld KiB peak RSS\n", name, ms,
+                  peak_rss_kb());
+    std::fflush(stdout);
+    _exit(0);
+  }
+  int status = 0;
+  if (pid > 0) waitpid(pid, &status, 0);
+}
+
+// pins the calling thread to cpu modulo the number of CPUs; false when the
+// platform refuses or does not support it
+inline bool pin_thread(unsigned cpu) {
+#ifdef __linux__
+  const unsigned cpus = std::thread::hardware_concurrency();
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpus ? cpu % cpus : 0, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  (void)cpu;
+  return false;
+#endif
+}
+
+inline void report(const char *name, double ms, std::size_t items) {
+  std::printf("%-36s %10.2f ms %10.1f Mitems/s\n", name, ms,
+              ms > 0 ? items / ms / 1000.0 : 0.0);
+}
+
+}  // namespace bench
+
+#endif  // BENCHMARKS_BENCH_COMMON_H
@@ -0,0 +1,101 @@
+// A stack shared as a free list: 1..16 threads each take a block off the
+// stack and put it back, plus one push_chain/pop_all round per 64 pairs.
+// s21::concurrent_stack without and with elimination against s21::stack
+// behind a std::mutex.
+// usage: bench_concurrent_stack [N]
+#include <cstdio>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 3;
+constexpr long kPrefill = 1024;
+
+class locked_stack {
+  std::mutex mutex_;
+  s21::stack<long> s_;
+
+ public:
+  explicit locked_stack(std::size_t) {}
+  void push(long value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    s_.push(value);
+  }
+  bool try_pop(long &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (s_.empty()) return false;
+    out = s_.top();
+    s_.pop();
+    return true;
+  }
+};
+
+template <typename Stack>
+void run(const char *label, std::size_t slots, unsigned threads,
+         std::size_t n) {
+  const std::size_t per_thread = n / threads;
+  char name[64];
+  std::snprintf(name, sizeof(name), "%2u threads %s", threads, label);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  Stack s(slots);
+                  for (long i = 0; i < kPrefill; ++i) s.push(i);
+                  std::vector<std::thread> pool;
+                  for (unsigned t = 0; t < threads; ++t)
+                    pool.emplace_back([&, t] {
+                      bench::pin_thread(t);
+                      long block = 0, sum = 0;
+                      for (std::size_t i = 0; i < per_thread; ++i) {
+                        if (s.try_pop(block)) sum += block;
+                        s.push(block);
+                      }
+                      bench::do_not_optimize(sum);
+                    });
+                  for (auto &thread : pool) thread.join();
+                }),
+                per_thread * threads);
+}
+
+void bulk(unsigned threads, std::size_t n) {
+  const std::size_t per_thread = n / threads;
+  char name[64];
+  std::snprintf(name, sizeof(name), "%2u threads chains of 64", threads);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  s21::concurrent_stack<long> s;
+                  std::vector<std::thread> pool;
+                  for (unsigned t = 0; t < threads; ++t)
+                    pool.emplace_back([&, t] {
+                      bench::pin_thread(t);
+                      std::vector<long> chain(64, long(t)), taken;
+                      for (std::size_t i = 0; i < per_thread; i += 64) {
+                        s.push_chain(chain.begin(), chain.end());
+                        taken.clear();
+                        s.pop_all(std::back_inserter(taken));
+                      }
+                      bench::do_not_optimize(taken);
+                    });
+                  for (auto &thread : pool) thread.join();
+                }),
+                per_thread * threads);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 4000000);
+  std::printf("-- %zu pop/push pairs, %u CPUs\n", n,
+              std::thread::hardware_concurrency());
+  for (unsigned threads : {1u, 2u, 4u, 8u, 16u}) {
+    run<s21::concurrent_stack<long>>("concurrent_stack", 0, threads, n);
+    run<s21::concurrent_stack<long>>("+ elimination", 16, threads, n);
+    run<locked_stack>("mutex + s21::stack", 0, threads, n);
+    bulk(threads, n);
+  }
+  return 0;
+}
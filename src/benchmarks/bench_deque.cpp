@@ -0,0 +1,104 @@
+// s21::deque vs s21::vector and s21::list: push_back, push_front, FIFO
+// traffic (push_back + pop_front), sequential and random-index reads.
+// usage: bench_deque [N]
+#include <cstdint>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+
+template <typename F>
+void line(const char *name, std::size_t n, F &&fn) {
+  bench::report(name, bench::best_of(kReps, fn), n);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, std::size_t{1} << 20);
+  std::printf("-- %zu int64 elements\n", n);
+
+  line("push_back   deque", n, [&] {
+    s21::deque<std::int64_t> d;
+    for (std::size_t i = 0; i < n; ++i) d.push_back(i);
+    bench::do_not_optimize(d.back());
+  });
+  line("push_back   vector", n, [&] {
+    s21::vector<std::int64_t> v;
+    for (std::size_t i = 0; i < n; ++i) v.push_back(i);
+    bench::do_not_optimize(v.back());
+  });
+  line("push_back   list", n, [&] {
+    s21::list<std::int64_t> l;
+    for (std::size_t i = 0; i < n; ++i) l.push_back(i);
+    bench::do_not_optimize(l.back());
+  });
+
+  line("push_front  deque", n, [&] {
+    s21::deque<std::int64_t> d;
+    for (std::size_t i = 0; i < n; ++i) d.push_front(i);
+    bench::do_not_optimize(d.front());
+  });
+  line("push_front  list", n, [&] {
+    s21::list<std::int64_t> l;
+    for (std::size_t i = 0; i < n; ++i) l.push_front(i);
+    bench::do_not_optimize(l.front());
+  });
+
+  // a queue holding ~1000 elements at any time
+  line("fifo        deque", n, [&] {
+    s21::deque<std::int64_t> d;
+    for (std::size_t i = 0; i < n; ++i) {
+      d.push_back(i);
+      if (i >= 1000) d.pop_front();
+    }
+    bench::do_not_optimize(d.front());
+  });
+  line("fifo        list", n, [&] {
+    s21::list<std::int64_t> l;
+    for (std::size_t i = 0; i < n; ++i) {
+      l.push_back(i);
+      if (i >= 1000) l.pop_front();
+    }
+    bench::do_not_optimize(l.front());
+  });
+
+  s21::deque<std::int64_t> d;
+  s21::vector<std::int64_t> v;
+  s21::list<std::int64_t> l;
+  for (std::size_t i = 0; i < n; ++i) {
+    d.push_back(i);
+    v.push_back(i);
+    l.push_back(i);
+  }
+  line("iterate     deque", n, [&] {
+    std::int64_t s = 0;
+    for (auto x : d) s += x;
+    bench::do_not_optimize(s);
+  });
+  line("iterate     vector", n, [&] {
+    std::int64_t s = 0;
+    for (auto x : v) s += x;
+    bench::do_not_optimize(s);
+  });
+  line("iterate     list", n, [&] {
+    std::int64_t s = 0;
+    for (auto x : l) s += x;
+    bench::do_not_optimize(s);
+  });
+  line("random []   deque", n, [&] {
+    std::int64_t s = 0;
+    for (std::size_t i = 0, j = 0; i < n; ++i, j = (j + 7919) % n) s += d[j];
+    bench::do_not_optimize(s);
+  });
+  line("random []   vector", n, [&] {
+    std::int64_t s = 0;
+    for (std::size_t i = 0, j = 0; i < n; ++i, j = (j + 7919) % n) s += v[j];
+    bench::do_not_optimize(s);
+  });
+  return 0;
+}
@@ -0,0 +1,82 @@
+// s21::dynamic_bitset vs a byte-per-flag s21::vector<bool> mask: memory,
+// count, AND of two masks and iteration over the set bits.
+// usage: bench_dynamic_bitset [BITS]
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+
+bool flag(std::size_t i, std::size_t seed) {
+  return ((i * 2654435761u + seed) >> 9) % 5 == 0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, std::size_t{1} << 27);
+  std::printf("-- %zu flags\n", n);
+
+  bench::isolated("build    vector<bool>", [&] {
+    s21::vector<bool> a;
+    a.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) a.push_back(flag(i, 1));
+    bench::do_not_optimize(a.data());
+  });
+  bench::isolated("build    dynamic_bitset", [&] {
+    s21::dynamic_bitset a;
+    a.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) a.push_back(flag(i, 1));
+    bench::do_not_optimize(a.data());
+  });
+
+  s21::vector<bool> va, vb;
+  s21::dynamic_bitset ba(n), bb(n);
+  va.reserve(n);
+  vb.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    va.push_back(flag(i, 1));
+    vb.push_back(flag(i, 2));
+    ba[i] = flag(i, 1);
+    bb[i] = flag(i, 2);
+  }
+
+  bench::report("count    vector<bool>", bench::best_of(kReps, [&] {
+                  std::size_t c = 0;
+                  for (bool x : va) c += x;
+                  bench::do_not_optimize(c);
+                }),
+                n);
+  bench::report("count    dynamic_bitset", bench::best_of(kReps, [&] {
+                  bench::do_not_optimize(ba.count());
+                }),
+                n);
+  bench::report("and      vector<bool>", bench::best_of(kReps, [&] {
+                  for (std::size_t i = 0; i < n; ++i) va[i] = va[i] && vb[i];
+                  bench::do_not_optimize(va.data());
+                }),
+                n);
+  bench::report("and      dynamic_bitset", bench::best_of(kReps, [&] {
+                  ba &= bb;
+                  bench::do_not_optimize(ba.data());
+                }),
+                n);
+  bench::report("set bits vector<bool>", bench::best_of(kReps, [&] {
+                  std::size_t s = 0;
+                  for (std::size_t i = 0; i < n; ++i)
+                    if (vb[i]) s += i;
+                  bench::do_not_optimize(s);
+                }),
+                n);
+  bench::report("set bits dynamic_bitset", bench::best_of(kReps, [&] {
+                  std::size_t s = 0;
+                  for (std::size_t i = bb.find_first();
+                       i != s21::dynamic_bitset::npos; i = bb.find_next(i))
+                    s += i;
+                  bench::do_not_optimize(s);
+                }),
+                n);
+  return 0;
+}
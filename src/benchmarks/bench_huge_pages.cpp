@@ -0,0 +1,107 @@
+// Random reads over a large buffer allocated with std::allocator and with
+// s21::huge_page_allocator; reports first-touch time, random-access
+// throughput and dTLB load misses (when perf events are available).
+// usage: bench_huge_pages [MiB] [reads]
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+class dtlb_counter {
+  int fd_ = -1;
+
+ public:
+  dtlb_counter() {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+  }
+  ~dtlb_counter() {
+    if (fd_ >= 0) close(fd_);
+  }
+  void start() {
+    if (fd_ < 0) return;
+    ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+  }
+  long long stop() {
+    if (fd_ < 0) return -1;
+    ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+    long long count = 0;
+    if (read(fd_, &count, sizeof(count)) != sizeof(count)) return -1;
+    return count;
+  }
+};
+
+template <typename Alloc>
+void run(const char *name, std::size_t elems, std::size_t reads) {
+  bench::timer t;
+  s21::vector<std::uint64_t, Alloc> v;
+  v.reserve(elems);
+  for (std::size_t i = 0; i < elems; ++i) v.push_back(i);
+  const double fill_ms = t.ms();
+
+  dtlb_counter tlb;
+  std::uint64_t x = 88172645463325252ull, sum = 0;
+  tlb.start();
+  t.reset();
+  for (std::size_t i = 0; i < reads; ++i) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    sum += v[x % elems];
+  }
+  const double read_ms = t.ms();
+  const long long misses = tlb.stop();
+  bench::do_not_optimize(sum);
+  std::printf("%-32s fill %8.1f ms  random %8.1f Mreads/s  %6ld MiB RSS"
+              "  dTLB misses ",
+              name, fill_ms, reads / read_ms / 1000.0,
+              bench::peak_rss_kb() >> 10);
+  if (misses < 0)
+    std::printf("n/a\n");
+  else
+    std::printf("%lld\n", misses);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t mib = bench::arg_size(argc, argv, 1024);
+  const std::size_t reads = bench::arg_size(argc, argv, 50000000, 2);
+  const std::size_t elems = (mib << 20) / sizeof(std::uint64_t);
+  std::printf("%zu MiB buffer, %zu random reads\n", mib, reads);
+  using s21::huge_page_mode;
+  using u64 = std::uint64_t;
+  bench::isolated(nullptr, [&] {
+    run<std::allocator<u64>>("std::allocator", elems, reads);
+  });
+  bench::isolated(nullptr, [&] {
+    run<s21::huge_page_allocator<u64>>("huge_page transparent", elems, reads);
+  });
+  bench::isolated(nullptr, [&] {
+    run<s21::huge_page_allocator<u64, (2 << 20), huge_page_mode::prefault>>(
+        "huge_page prefault", elems, reads);
+  });
+  bench::isolated(nullptr, [&] {
+    run<s21::huge_page_allocator<u64, (2 << 20),
+                                 huge_page_mode::transparent_prefault>>(
+        "huge_page transparent+prefault", elems, reads);
+  });
+  return 0;
+}
@@ -0,0 +1,74 @@
+// Moving timer-like objects between the slots of a timer wheel: linking
+// their embedded hooks into s21::intrusive_list vs keeping pointers to them
+// in s21::list, which allocates a node per link.
+// usage: bench_intrusive_list [N]
+#include <cstdio>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+constexpr std::size_t kSlots = 256;
+constexpr std::size_t kOps = 4000000;
+
+struct timer {
+  s21::listNode_base slot_hook;
+  std::size_t deadline = 0;
+};
+
+using slot_list = s21::intrusive_list<timer, &timer::slot_hook>;
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 100000);
+  std::printf("-- %zu timers, %zu slots, %zu reschedules\n", n, kSlots, kOps);
+  s21::vector<timer> timers;
+  timers.resize(n);
+
+  bench::report("intrusive_list", bench::best_of(kReps, [&] {
+                  s21::vector<slot_list> wheel;
+                  wheel.resize(kSlots);
+                  for (std::size_t i = 0; i < n; ++i)
+                    wheel[i % kSlots].push_back(timers[i]);
+                  for (std::size_t i = 0; i < kOps; ++i) {
+                    timer &t = timers[(i * 7919) % n];
+                    t.slot_hook.unlink();
+                    t.deadline += i;
+                    wheel[t.deadline % kSlots].push_back(t);
+                  }
+                  bench::do_not_optimize(wheel[0].empty());
+                }),
+                kOps);
+
+  bench::report("list<timer *>", bench::best_of(kReps, [&] {
+                  using slot = s21::list<timer *>;
+                  s21::vector<slot> wheel;
+                  wheel.resize(kSlots);
+                  // where each timer sits, as an owner would have to track
+                  s21::vector<slot::iterator> where;
+                  s21::vector<std::size_t> in;
+                  for (std::size_t i = 0; i < n; ++i) {
+                    slot &s = wheel[i % kSlots];
+                    s.push_back(&timers[i]);
+                    where.push_back(--s.end());
+                    in.push_back(i % kSlots);
+                  }
+                  for (std::size_t i = 0; i < kOps; ++i) {
+                    const std::size_t k = (i * 7919) % n;
+                    timer &t = timers[k];
+                    wheel[in[k]].erase(where[k]);
+                    t.deadline += i;
+                    in[k] = t.deadline % kSlots;
+                    slot &s = wheel[in[k]];
+                    s.push_back(&t);
+                    where[k] = --s.end();
+                  }
+                  bench::do_not_optimize(wheel[0].empty());
+                }),
+                kOps);
+  return 0;
+}
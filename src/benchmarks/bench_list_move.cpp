@@ -0,0 +1,55 @@
+// Building s21::list<std::string> in a function and returning it, then
+// handing it on by copy vs by move, and push_back of temporaries vs
+// emplace_back.
+// usage: bench_list_move [N]
+#include <cstdio>
+#include <string>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+
+s21::list<std::string> make(std::size_t n) {
+  s21::list<std::string> l;
+  for (std::size_t i = 0; i < n; ++i)
+    l.emplace_back(48, static_cast<char>('a' + i % 26));
+  return l;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 1000000);
+  std::printf("-- %zu strings of 48 chars\n", n);
+  s21::list<std::string> source = make(n);
+
+  bench::report("copy construct", bench::best_of(kReps, [&] {
+                  s21::list<std::string> copy(source);
+                  bench::do_not_optimize(copy.size());
+                }),
+                n);
+  bench::report("move construct", bench::best_of(kReps, [&] {
+                  s21::list<std::string> moved(std::move(source));
+                  bench::do_not_optimize(moved.size());
+                  source = std::move(moved);
+                }),
+                n);
+  bench::report("push_back(std::string(...))", bench::best_of(kReps, [&] {
+                  s21::list<std::string> l;
+                  for (std::size_t i = 0; i < n; ++i)
+                    l.push_back(std::string(48, 'x'));
+                  bench::do_not_optimize(l.size());
+                }),
+                n);
+  bench::report("emplace_back(48, 'x')", bench::best_of(kReps, [&] {
+                  s21::list<std::string> l;
+                  for (std::size_t i = 0; i < n; ++i) l.emplace_back(48, 'x');
+                  bench::do_not_optimize(l.size());
+                }),
+                n);
+  return 0;
+}
@@ -0,0 +1,62 @@
+// s21::list::sort vs std::list::sort on sorted, reverse-sorted and random
+// lists of 128-byte records keyed by an int. The merge sort relinks nodes,
+// so the payload size does not matter to it.
+// usage: bench_list_sort [N]
+#include <cstdint>
+#include <cstdio>
+#include <list>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+struct Record {
+  std::int64_t key;
+  char payload[120];
+};
+
+bool by_key(const Record &a, const Record &b) { return a.key < b.key; }
+
+template <typename List>
+void fill(List &l, std::size_t n, int order) {
+  std::uint64_t x = 88172645463325252ULL;
+  for (std::size_t i = 0; i < n; ++i) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    Record r{};
+    r.key = order == 0   ? static_cast<std::int64_t>(i)
+            : order == 1 ? static_cast<std::int64_t>(n - i)
+                         : static_cast<std::int64_t>(x % n);
+    l.push_back(r);
+  }
+}
+
+template <typename List>
+void run(const char *name, std::size_t n, int order) {
+  bench::isolated(nullptr, [&] {
+    List l;
+    fill(l, n, order);
+    bench::timer t;
+    l.sort(by_key);
+    const double ms = t.ms();
+    bench::do_not_optimize(l.front().key);
+    bench::report(name, ms, n);
+  });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 1000000);
+  std::printf("-- %zu records, %zu bytes each\n", n, sizeof(Record));
+  run<s21::list<Record>>("sorted   s21::list", n, 0);
+  run<std::list<Record>>("sorted   std::list", n, 0);
+  run<s21::list<Record>>("reversed s21::list", n, 1);
+  run<std::list<Record>>("reversed std::list", n, 1);
+  run<s21::list<Record>>("random   s21::list", n, 2);
+  run<std::list<Record>>("random   std::list", n, 2);
+  return 0;
+}
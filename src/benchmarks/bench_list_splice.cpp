@@ -0,0 +1,71 @@
+// Splicing between s21::list and std::list: a whole list moved back and
+// forth between two lists, LRU-style move-to-front of single nodes, and
+// ranges of 64 nodes rotated from the front to the back.
+// usage: bench_list_splice [N]
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+constexpr std::size_t kOps = 1000000;
+
+template <typename List>
+void run(const char *label, std::size_t n) {
+  List a, b;
+  for (std::size_t i = 0; i < n; ++i) a.push_back(static_cast<int>(i));
+  std::vector<typename List::const_iterator> nodes;
+  for (auto it = a.cbegin(); it != a.cend(); ++it) nodes.push_back(it);
+  char name[64];
+
+  std::snprintf(name, sizeof(name), "whole list    %s", label);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  for (std::size_t i = 0; i < kOps / 2; ++i) {
+                    b.splice(b.cend(), a);
+                    a.splice(a.cend(), b);
+                  }
+                  bench::do_not_optimize(a.size());
+                }),
+                kOps);
+
+  std::snprintf(name, sizeof(name), "move to front %s", label);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  std::uint64_t x = 88172645463325252ULL;
+                  for (std::size_t i = 0; i < kOps; ++i) {
+                    x ^= x << 13;
+                    x ^= x >> 7;
+                    x ^= x << 17;
+                    a.splice(a.cbegin(), a, nodes[x % n]);
+                  }
+                  bench::do_not_optimize(a.front());
+                }),
+                kOps);
+
+  std::snprintf(name, sizeof(name), "range of 64   %s", label);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  for (std::size_t i = 0; i < kOps / 64; ++i) {
+                    auto last = a.cbegin();
+                    for (int k = 0; k < 64; ++k) ++last;
+                    b.splice(b.cend(), a, a.cbegin(), last);
+                    a.splice(a.cend(), b, b.cbegin(), b.cend());
+                  }
+                  bench::do_not_optimize(a.front());
+                }),
+                kOps);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 100000);
+  std::printf("-- %zu nodes, %zu operations\n", n, kOps);
+  run<s21::list<int>>("s21::list", n);
+  run<std::list<int>>("std::list", n);
+  return 0;
+}
@@ -0,0 +1,100 @@
+// Cold start of a feature table: read() + deserialize into s21::vector vs
+// opening it as a read-only s21::mmap_vector. The file's pages are dropped
+// from the page cache (posix_fadvise DONTNEED) before every run.
+// usage: bench_mmap_vector [RECORDS]
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <string>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+struct feature {
+  std::int64_t key;
+  float weights[6];
+};
+
+void drop_cache(const std::string &path) {
+  const int fd = open(path.c_str(), O_RDONLY);
+  fdatasync(fd);
+  posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+  close(fd);
+}
+
+// sum over 1000 random records, what a request would touch first
+template <typename V>
+double lookups(const V &v) {
+  double s = 0;
+  for (std::size_t i = 0, j = 0; i < 1000; ++i, j = (j + 104729) % v.size())
+    s += v[j].weights[0];
+  return s;
+}
+
+template <typename V>
+double scan(const V &v) {
+  double s = 0;
+  for (const feature &f : v) s += f.weights[1];
+  return s;
+}
+
+// times are cumulative since the start of the run
+void print(const char *name, double ready, double first, double done) {
+  std::printf("%-17s ready %7.2f ms, looked up %7.2f ms, scanned %7.2f ms,"
+              " peak RSS %ld KiB\n",
+              name, ready, first, done, bench::peak_rss_kb());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, std::size_t{1} << 23);
+  const std::string path = "/tmp/s21_bench_mmap_vector_" +
+                           std::to_string(getpid());
+  {
+    s21::mmap_vector<feature> out(path, s21::mmap_mode::create);
+    out.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      feature f{static_cast<std::int64_t>(i), {}};
+      for (int k = 0; k < 6; ++k) f.weights[k] = static_cast<float>(i % 97);
+      out.push_back(f);
+    }
+  }
+  std::printf("-- %zu records, %zu MiB\n", n, n * sizeof(feature) >> 20);
+
+  bench::isolated(nullptr, [&] {
+    drop_cache(path);
+    bench::timer t;
+    s21::vector<feature> v;
+    v.resize_default_init(n);
+    const int fd = open(path.c_str(), O_RDONLY);
+    char *dst = reinterpret_cast<char *>(v.data());
+    for (std::size_t done = 0, total = n * sizeof(feature); done < total;) {
+      const ssize_t r = read(fd, dst + done, total - done);
+      if (r <= 0) break;
+      done += static_cast<std::size_t>(r);
+    }
+    close(fd);
+    const double ready = t.ms();
+    bench::do_not_optimize(lookups(v));
+    const double first = t.ms();
+    bench::do_not_optimize(scan(v));
+    print("read into vector", ready, first, t.ms());
+  });
+  bench::isolated(nullptr, [&] {
+    drop_cache(path);
+    bench::timer t;
+    const s21::mmap_vector<feature> v(path);
+    const double ready = t.ms();
+    bench::do_not_optimize(lookups(v));
+    const double first = t.ms();
+    bench::do_not_optimize(scan(v));
+    print("mmap_vector", ready, first, t.ms());
+  });
+  std::remove(path.c_str());
+  return 0;
+}
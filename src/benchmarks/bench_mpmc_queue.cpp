@@ -0,0 +1,127 @@
+// Task-queue throughput with 1..32 producers and as many consumers:
+// s21::mpmc_queue with blocking push/pop and with bulk transfers of 16,
+// against s21::queue behind a std::mutex and two condition variables, the
+// thread pool queue it replaces. Each producer passes N / threads items.
+// usage: bench_mpmc_queue [N]
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 3;
+constexpr std::size_t kCapacity = 1024;
+constexpr std::size_t kBatch = 16;
+
+class locked_queue {
+  std::mutex mutex_;
+  std::condition_variable not_empty_, not_full_;
+  s21::queue<long> q_;
+
+ public:
+  explicit locked_queue(std::size_t) {}
+  void push(long value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [&] { return q_.size() < kCapacity; });
+    q_.push(value);
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+  long pop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [&] { return !q_.empty(); });
+    const long value = q_.front();
+    q_.pop();
+    lock.unlock();
+    not_full_.notify_one();
+    return value;
+  }
+};
+
+struct single_ops {
+  template <typename Queue>
+  static void produce(Queue &q, std::size_t from, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) q.push(long(from + i));
+  }
+  template <typename Queue>
+  static long consume(Queue &q, std::size_t n) {
+    long sum = 0;
+    for (std::size_t i = 0; i < n; ++i) sum += q.pop();
+    return sum;
+  }
+};
+
+struct bulk_ops {
+  static void produce(s21::mpmc_queue<long> &q, std::size_t from,
+                      std::size_t n) {
+    long batch[kBatch];
+    for (std::size_t i = 0; i < n;) {
+      const std::size_t k = n - i < kBatch ? n - i : kBatch;
+      for (std::size_t j = 0; j < k; ++j) batch[j] = long(from + i + j);
+      std::size_t done = q.try_push_bulk(batch, k);
+      if (done == 0) {
+        q.push(batch[0]);
+        done = 1;
+      }
+      i += done;
+    }
+  }
+  static long consume(s21::mpmc_queue<long> &q, std::size_t n) {
+    long batch[kBatch], sum = 0;
+    for (std::size_t i = 0; i < n;) {
+      std::size_t done = q.try_pop_bulk(batch, n - i < kBatch ? n - i : kBatch);
+      if (done == 0) {
+        batch[0] = q.pop();
+        done = 1;
+      }
+      for (std::size_t j = 0; j < done; ++j) sum += batch[j];
+      i += done;
+    }
+    return sum;
+  }
+};
+
+template <typename Queue, typename Ops>
+void run(const char *label, unsigned threads, std::size_t n) {
+  const std::size_t per_thread = n / threads;
+  char name[64];
+  std::snprintf(name, sizeof(name), "%2u+%-2u %s", threads, threads, label);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  Queue q(kCapacity);
+                  std::vector<std::thread> pool;
+                  std::vector<long> sums(threads);
+                  for (unsigned t = 0; t < threads; ++t) {
+                    pool.emplace_back([&, t] {
+                      bench::pin_thread(2 * t);
+                      Ops::produce(q, t * per_thread, per_thread);
+                    });
+                    pool.emplace_back([&, t] {
+                      bench::pin_thread(2 * t + 1);
+                      sums[t] = Ops::consume(q, per_thread);
+                    });
+                  }
+                  for (auto &thread : pool) thread.join();
+                  bench::do_not_optimize(sums);
+                }),
+                per_thread * threads);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 4000000);
+  std::printf("-- %zu items, capacity %zu, %u CPUs\n", n, kCapacity,
+              std::thread::hardware_concurrency());
+  for (unsigned threads : {1u, 2u, 4u, 8u, 16u, 32u}) {
+    run<s21::mpmc_queue<long>, single_ops>("mpmc_queue push/pop", threads, n);
+    run<s21::mpmc_queue<long>, bulk_ops>("mpmc_queue bulk of 16", threads, n);
+    run<locked_queue, single_ops>("mutex + s21::queue", threads, n);
+  }
+  return 0;
+}
@@ -0,0 +1,58 @@
+// Scaling of s21::parallel_sort / parallel_stable_sort over 1..16 threads
+// for int, double and 32-byte records.
+// usage: bench_parallel_sort [N]
+#include <cstdint>
+#include <random>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+struct record {
+  std::uint64_t key;
+  char payload[24];
+  bool operator<(const record &other) const { return key < other.key; }
+};
+
+template <typename T>
+T make(std::uint64_t x) {
+  if constexpr (std::is_same_v<T, record>)
+    return record{x, {}};
+  else
+    return static_cast<T>(x);
+}
+
+template <typename T>
+void run(const char *type, std::size_t n) {
+  std::mt19937_64 gen(1);
+  s21::vector<T> input;
+  input.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) input.push_back(make<T>(gen()));
+  std::printf("-- %s, %zu elements\n", type, n);
+  for (unsigned threads : {1u, 2u, 4u, 8u, 16u}) {
+    for (bool stable : {false, true}) {
+      auto v = input;
+      bench::timer t;
+      if (stable)
+        s21::parallel_stable_sort(v, std::less<T>(), {threads});
+      else
+        s21::parallel_sort(v, std::less<T>(), {threads});
+      char name[64];
+      std::snprintf(name, sizeof(name), "%2u threads %s", threads,
+                    stable ? "stable" : "unstable");
+      bench::report(name, t.ms(), n);
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 20000000);
+  run<int>("int", n);
+  run<double>("double", n);
+  run<record>("32-byte record", n);
+  return 0;
+}
@@ -0,0 +1,103 @@
+// s21::priority_queue (4-ary heap over s21::vector) against s21::multiset
+// used as a priority queue: N random pushes then N pops, a steady-state
+// scheduler mix of one push and one pop with N elements queued, and
+// building the queue from N values with the heapify constructor, with
+// push_bulk and with N pushes.
+// usage: bench_priority_queue [N]
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+
+// multiset with the priority_queue interface, the greatest key at the end
+class multiset_queue {
+ public:
+  explicit multiset_queue(std::size_t) {}
+  void push(int value) { set_.insert(value); }
+  int top() { return *--set_.end(); }
+  void pop() { set_.erase(--set_.end()); }
+  bool empty() const { return set_.empty(); }
+
+ private:
+  s21::multiset<int> set_;
+};
+
+class heap_queue : public s21::priority_queue<int> {
+ public:
+  explicit heap_queue(std::size_t) {}
+};
+
+template <typename Queue>
+void run(const char *label, const std::vector<int> &values) {
+  const std::size_t n = values.size();
+  char name[64];
+
+  std::snprintf(name, sizeof(name), "push/pop all %s", label);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  Queue q(n);
+                  for (int v : values) q.push(v);
+                  long sum = 0;
+                  while (!q.empty()) {
+                    sum += q.top();
+                    q.pop();
+                  }
+                  bench::do_not_optimize(sum);
+                }),
+                2 * n);
+
+  std::snprintf(name, sizeof(name), "steady       %s", label);
+  Queue q(n);
+  for (int v : values) q.push(v);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  long sum = 0;
+                  for (int v : values) {
+                    // a task reschedules itself a little later
+                    const int t = q.top();
+                    sum += t;
+                    q.pop();
+                    q.push(t - (v & 1023));
+                  }
+                  bench::do_not_optimize(sum);
+                }),
+                2 * n);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 1000000);
+  std::mt19937 gen(42);
+  std::vector<int> values(n);
+  for (auto &v : values) v = int(gen() >> 1);
+
+  std::printf("-- %zu elements\n", n);
+  run<heap_queue>("priority_queue", values);
+  run<multiset_queue>("multiset", values);
+
+  std::printf("-- build from %zu values\n", n);
+  bench::report("heapify constructor", bench::best_of(kReps, [&] {
+                  s21::priority_queue<int> q(values.begin(), values.end());
+                  bench::do_not_optimize(q.top());
+                }),
+                n);
+  bench::report("push_bulk", bench::best_of(kReps, [&] {
+                  s21::priority_queue<int> q;
+                  q.push_bulk(values.begin(), values.end());
+                  bench::do_not_optimize(q.top());
+                }),
+                n);
+  bench::report("N x push", bench::best_of(kReps, [&] {
+                  s21::priority_queue<int> q;
+                  for (int v : values) q.push(v);
+                  bench::do_not_optimize(q.top());
+                }),
+                n);
+  return 0;
+}
@@ -0,0 +1,60 @@
+// Push/pop throughput of s21::queue over its default ring_buffer, over
+// s21::list (one node allocation per element) and over s21::deque: a
+// steady-state FIFO holding N elements, and bursts that fill the queue to N
+// and drain it again.
+// usage: bench_ring_queue [N]
+#include <cstdio>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+constexpr std::size_t kOps = 4000000;
+
+template <typename Queue>
+void run(const char *label, std::size_t n) {
+  char name[64];
+
+  std::snprintf(name, sizeof(name), "steady  %s", label);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  Queue q;
+                  for (std::size_t i = 0; i < n; ++i) q.push(int(i));
+                  long sum = 0;
+                  for (std::size_t i = 0; i < kOps; ++i) {
+                    sum += q.front();
+                    q.pop();
+                    q.push(int(i));
+                  }
+                  bench::do_not_optimize(sum);
+                }),
+                kOps);
+
+  std::snprintf(name, sizeof(name), "bursts  %s", label);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  Queue q;
+                  long sum = 0;
+                  for (std::size_t done = 0; done < kOps; done += n) {
+                    for (std::size_t i = 0; i < n; ++i) q.push(int(i));
+                    while (!q.empty()) {
+                      sum += q.front();
+                      q.pop();
+                    }
+                  }
+                  bench::do_not_optimize(sum);
+                }),
+                kOps);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 1000);
+  std::printf("-- %zu elements in flight, %zu operations\n", n, kOps);
+  run<s21::queue<int>>("ring_buffer", n);
+  run<s21::queue<int, s21::list<int>>>("list", n);
+  run<s21::queue<int, s21::deque<int>>>("deque", n);
+  return 0;
+}
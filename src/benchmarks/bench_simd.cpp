@@ -0,0 +1,96 @@
+// Scalar loops over VectorIterator_base vs std:: algorithms vs s21::simd on
+// s21::vector<int32_t/float/double>.
+// usage: bench_simd [N]
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+
+template <typename T>
+void run(const char *type, std::size_t n) {
+  s21::vector<T> v;
+  v.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+    v.push_back(static_cast<T>((i * 2654435761u) % 100000));
+  const T absent = static_cast<T>(-1);
+  std::printf("-- %s, %zu elements\n", type, n);
+  char name[64];
+
+  auto line = [&](const char *op, const char *impl, auto &&fn) {
+    std::snprintf(name, sizeof(name), "%-8s %s", op, impl);
+    bench::report(name, bench::best_of(kReps, fn), n);
+  };
+
+  line("find", "scalar", [&] {
+    auto it = v.begin();
+    for (auto e = v.end(); it != e && *it != absent;) ++it;
+    bench::do_not_optimize(it);
+  });
+  line("find", "std", [&] {
+    bench::do_not_optimize(std::find(v.data(), v.data() + n, absent));
+  });
+  line("find", "simd", [&] {
+    bench::do_not_optimize(s21::simd::find(v, absent));
+  });
+
+  line("count", "scalar", [&] {
+    std::size_t c = 0;
+    for (auto it = v.begin(), e = v.end(); it != e; ++it) c += *it == T(7);
+    bench::do_not_optimize(c);
+  });
+  line("count", "std", [&] {
+    bench::do_not_optimize(std::count(v.data(), v.data() + n, T(7)));
+  });
+  line("count", "simd", [&] {
+    bench::do_not_optimize(s21::simd::count(v, T(7)));
+  });
+
+  line("min", "scalar", [&] {
+    auto best = v.begin();
+    for (auto it = v.begin(), e = v.end(); it != e; ++it)
+      if (*it < *best) best = it;
+    bench::do_not_optimize(best);
+  });
+  line("min", "std", [&] {
+    bench::do_not_optimize(std::min_element(v.data(), v.data() + n));
+  });
+  line("min", "simd", [&] {
+    bench::do_not_optimize(s21::simd::min_element(v));
+  });
+
+  line("max", "std", [&] {
+    bench::do_not_optimize(std::max_element(v.data(), v.data() + n));
+  });
+  line("max", "simd", [&] {
+    bench::do_not_optimize(s21::simd::max_element(v));
+  });
+
+  line("sum", "scalar", [&] {
+    T s{};
+    for (auto it = v.begin(), e = v.end(); it != e; ++it) s += *it;
+    bench::do_not_optimize(s);
+  });
+  line("sum", "std", [&] {
+    bench::do_not_optimize(std::accumulate(v.data(), v.data() + n, T{}));
+  });
+  line("sum", "simd", [&] {
+    bench::do_not_optimize(s21::simd::accumulate(v));
+  });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 1 << 24);
+  run<std::int32_t>("int32_t", n);
+  run<float>("float", n);
+  run<double>("double", n);
+  return 0;
+}
@@ -0,0 +1,76 @@
+// Field-sum scans over records stored as s21::vector<Record> (array of
+// structures) vs s21::soa_vector (one column per field), summing one and
+// two fields of a 64-byte record.
+// usage: bench_soa_vector [N]
+#include <cstdint>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+
+struct Record {
+  double x, y, z;
+  double mass;
+  std::int64_t id;
+  std::int32_t flags;
+  char tag[20];
+};
+static_assert(sizeof(Record) == 64, "one record per cache line");
+
+using Columns = s21::soa_vector<double, double, double, double, std::int64_t,
+                                std::int32_t>;
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, std::size_t{1} << 22);
+  s21::vector<Record> aos;
+  Columns soa;
+  aos.reserve(n);
+  soa.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double v = static_cast<double>(i % 1000);
+    aos.push_back(Record{v, v + 1, v + 2, v * 0.5,
+                         static_cast<std::int64_t>(i), 0, {}});
+    soa.emplace_back(v, v + 1, v + 2, v * 0.5, static_cast<std::int64_t>(i),
+                     0);
+  }
+  std::printf("-- %zu records, %zu bytes each\n", n, sizeof(Record));
+
+  bench::report("sum x      aos", bench::best_of(kReps, [&] {
+                  double s = 0;
+                  for (const Record &r : aos) s += r.x;
+                  bench::do_not_optimize(s);
+                }),
+                n);
+  bench::report("sum x      soa", bench::best_of(kReps, [&] {
+                  double s = 0;
+                  for (double x : soa.column<0>()) s += x;
+                  bench::do_not_optimize(s);
+                }),
+                n);
+  bench::report("sum x*mass aos", bench::best_of(kReps, [&] {
+                  double s = 0;
+                  for (const Record &r : aos) s += r.x * r.mass;
+                  bench::do_not_optimize(s);
+                }),
+                n);
+  bench::report("sum x*mass soa", bench::best_of(kReps, [&] {
+                  const double *x = soa.data<0>(), *m = soa.data<3>();
+                  double s = 0;
+                  for (std::size_t i = 0; i < n; ++i) s += x[i] * m[i];
+                  bench::do_not_optimize(s);
+                }),
+                n);
+  bench::report("sum x      soa rows", bench::best_of(kReps, [&] {
+                  double s = 0;
+                  for (auto row : soa) s += std::get<0>(row);
+                  bench::do_not_optimize(s);
+                }),
+                n);
+  return 0;
+}
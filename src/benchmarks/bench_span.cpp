@@ -0,0 +1,86 @@
+// Passing sub-ranges of an s21::vector<double> to a summing function as
+// copies (a new s21::vector per slice) vs s21::span views of the same
+// storage, plus a strided column walk of a row-major matrix.
+// usage: bench_span [N]
+#include <cstdio>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+constexpr std::size_t kSlice = 256;
+
+double sum_copy(s21::vector<double> v) {
+  double s = 0;
+  for (double x : v) s += x;
+  return s;
+}
+
+double sum_span(s21::span<const double> v) {
+  double s = 0;
+  for (double x : v) s += x;
+  return s;
+}
+
+double sum_strided(s21::strided_span<const double> v) {
+  double s = 0;
+  for (double x : v) s += x;
+  return s;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, std::size_t{1} << 22);
+  s21::vector<double> data;
+  data.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+    data.push_back(static_cast<double>(i % 97));
+  const std::size_t slices = n / kSlice;
+  std::printf("-- %zu doubles, %zu slices of %zu\n", n, slices, kSlice);
+
+  bench::report("slices copied", bench::best_of(kReps, [&] {
+                  double s = 0;
+                  for (std::size_t i = 0; i < slices; ++i) {
+                    s21::vector<double> slice;
+                    slice.reserve(kSlice);
+                    for (std::size_t j = 0; j < kSlice; ++j)
+                      slice.push_back(data[i * kSlice + j]);
+                    s += sum_copy(std::move(slice));
+                  }
+                  bench::do_not_optimize(s);
+                }),
+                n);
+  bench::report("slices as span", bench::best_of(kReps, [&] {
+                  const s21::span<const double> all(data);
+                  double s = 0;
+                  for (std::size_t i = 0; i < slices; ++i)
+                    s += sum_span(all.subspan(i * kSlice, kSlice));
+                  bench::do_not_optimize(s);
+                }),
+                n);
+  bench::report("columns copied", bench::best_of(kReps, [&] {
+                  double s = 0;
+                  for (std::size_t c = 0; c < kSlice; ++c) {
+                    s21::vector<double> col;
+                    col.reserve(slices);
+                    for (std::size_t r = 0; r < slices; ++r)
+                      col.push_back(data[r * kSlice + c]);
+                    s += sum_copy(std::move(col));
+                  }
+                  bench::do_not_optimize(s);
+                }),
+                n);
+  bench::report("columns as strided_span", bench::best_of(kReps, [&] {
+                  double s = 0;
+                  for (std::size_t c = 0; c < kSlice; ++c)
+                    s += sum_strided(s21::strided_span<const double>(
+                        data.data() + c, slices, kSlice));
+                  bench::do_not_optimize(s);
+                }),
+                n);
+  return 0;
+}
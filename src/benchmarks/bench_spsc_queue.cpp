@@ -0,0 +1,152 @@
+// Message passing between two threads pinned to CPUs 0 and 1: throughput of
+// s21::spsc_queue with single and bulk operations against s21::queue behind
+// a std::mutex, and ping-pong round-trip latency through a pair of queues.
+// usage: bench_spsc_queue [N]
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 3;
+constexpr std::size_t kCapacity = 1024;
+constexpr std::size_t kBatch = 32;
+
+// s21::queue as the pipeline used it: every operation takes the lock
+class locked_queue {
+  std::mutex mutex_;
+  s21::queue<long> q_;
+
+ public:
+  explicit locked_queue(std::size_t) {}
+  bool try_push(long value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (q_.size() == kCapacity) return false;
+    q_.push(value);
+    return true;
+  }
+  bool try_pop(long &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (q_.empty()) return false;
+    out = q_.front();
+    q_.pop();
+    return true;
+  }
+};
+
+// runs producer on CPU 0 and consumer on CPU 1, returns the wall time
+template <typename Producer, typename Consumer>
+double two_threads(Producer &&producer, Consumer &&consumer) {
+  bench::timer t;
+  std::thread other([&] {
+    bench::pin_thread(1);
+    consumer();
+  });
+  bench::pin_thread(0);
+  producer();
+  other.join();
+  return t.ms();
+}
+
+template <typename Queue>
+void single(const char *name, std::size_t n) {
+  bench::report(name, bench::best_of(kReps, [&] {
+                  Queue q(kCapacity);
+                  long sum = 0;
+                  two_threads(
+                      [&] {
+                        for (std::size_t i = 0; i < n;)
+                          if (q.try_push(long(i)))
+                            ++i;
+                          else
+                            std::this_thread::yield();
+                      },
+                      [&] {
+                        long value;
+                        for (std::size_t i = 0; i < n;)
+                          if (q.try_pop(value)) {
+                            sum += value;
+                            ++i;
+                          } else {
+                            std::this_thread::yield();
+                          }
+                      });
+                  bench::do_not_optimize(sum);
+                }),
+                n);
+}
+
+void bulk(std::size_t n) {
+  bench::report("spsc_queue bulk of 32", bench::best_of(kReps, [&] {
+                  s21::spsc_queue<long> q(kCapacity);
+                  long sum = 0;
+                  two_threads(
+                      [&] {
+                        long batch[kBatch];
+                        for (std::size_t i = 0; i < n;) {
+                          const std::size_t k =
+                              n - i < kBatch ? n - i : kBatch;
+                          for (std::size_t j = 0; j < k; ++j)
+                            batch[j] = long(i + j);
+                          const std::size_t done = q.push_bulk(batch, k);
+                          if (done == 0) std::this_thread::yield();
+                          i += done;
+                        }
+                      },
+                      [&] {
+                        long batch[kBatch];
+                        for (std::size_t i = 0; i < n;) {
+                          const std::size_t done = q.pop_bulk(batch, kBatch);
+                          for (std::size_t j = 0; j < done; ++j)
+                            sum += batch[j];
+                          if (done == 0) std::this_thread::yield();
+                          i += done;
+                        }
+                      });
+                  bench::do_not_optimize(sum);
+                }),
+                n);
+}
+
+// one message there and back per round trip, reported in ns
+template <typename Queue>
+void latency(const char *name, std::size_t trips) {
+  const double ms = bench::best_of(kReps, [&] {
+    Queue ping(kCapacity), pong(kCapacity);
+    two_threads(
+        [&] {
+          long value;
+          for (std::size_t i = 0; i < trips; ++i) {
+            while (!ping.try_push(long(i))) std::this_thread::yield();
+            while (!pong.try_pop(value)) std::this_thread::yield();
+          }
+        },
+        [&] {
+          long value;
+          for (std::size_t i = 0; i < trips; ++i) {
+            while (!ping.try_pop(value)) std::this_thread::yield();
+            while (!pong.try_push(value)) std::this_thread::yield();
+          }
+        });
+  });
+  std::printf("%-36s %10.2f ms %10.1f ns/round trip\n", name, ms,
+              ms * 1e6 / trips);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 10000000);
+  std::printf("-- %zu messages, capacity %zu, %u CPUs\n", n, kCapacity,
+              std::thread::hardware_concurrency());
+  single<s21::spsc_queue<long>>("spsc_queue try_push/try_pop", n);
+  bulk(n);
+  single<locked_queue>("mutex + s21::queue", n);
+  latency<s21::spsc_queue<long>>("spsc_queue ping-pong", n / 100);
+  latency<locked_queue>("mutex + s21::queue ping-pong", n / 100);
+  return 0;
+}
@@ -0,0 +1,66 @@
+// Cost of s21::tracking_allocator over its base allocator, and the kind of
+// per-container report it produces for a mixed workload.
+// usage: bench_tracking_allocator [N]
+#include <string>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+
+template <typename Alloc>
+void churn(std::size_t n) {
+  s21::list<int, Alloc> l;
+  for (std::size_t i = 0; i < n; ++i) l.push_back(static_cast<int>(i));
+  while (!l.empty()) l.pop_front();
+}
+
+void print(const char *name, const s21::allocation_stats &s) {
+  std::printf("%-10s %9zu allocs %9zu frees %6zu reallocs %11zu bytes"
+              " %11zu peak\n",
+              name, s.allocations(), s.deallocations(), s.reallocations(),
+              s.allocated_bytes(), s.peak_bytes());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, std::size_t{1} << 20);
+  std::printf("-- %zu list nodes allocated and freed\n", n);
+  bench::report("std::allocator", bench::best_of(kReps, [&] {
+                  churn<std::allocator<int>>(n);
+                }),
+                n);
+  bench::report("tracking_allocator", bench::best_of(kReps, [&] {
+                  churn<s21::tracking_allocator<int>>(n);
+                }),
+                n);
+
+  std::printf("-- allocation report, %zu elements per container\n", n);
+  s21::vector<std::string, s21::tracking_allocator<std::string>> names;
+  s21::map<int, int, s21::tracking_allocator<std::pair<const int, int>>> index;
+  s21::queue<int, s21::ring_buffer<int, s21::tracking_allocator<int>>> work;
+  s21::deque<int, s21::tracking_allocator<int>> window;
+  for (std::size_t i = 0; i < n; ++i) {
+    names.push_back(std::to_string(i));
+    index.insert(static_cast<int>(i), static_cast<int>(i));
+    work.push(static_cast<int>(i));
+    window.push_back(static_cast<int>(i));
+    if (i >= 1000) window.pop_front();
+  }
+  print("vector", names.get_allocator().stats());
+  print("map", index.get_allocator().stats());
+  print("queue", work.get_allocator().stats());
+  print("deque", window.get_allocator().stats());
+  print("global", s21::allocation_stats::global());
+  std::printf("size histogram (global):\n");
+  const s21::allocation_stats &g = s21::allocation_stats::global();
+  for (std::size_t b = 0; b < s21::allocation_stats::buckets; ++b) {
+    if (g.histogram(b) == 0) continue;
+    std::printf("  < %12zu bytes: %zu\n", std::size_t{1} << b, g.histogram(b));
+  }
+  return 0;
+}
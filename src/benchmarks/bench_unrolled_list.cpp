@@ -0,0 +1,62 @@
+// s21::unrolled_list vs s21::list on ints: building by push_back, a full
+// scan, and one pass inserting a new element after every existing one.
+// usage: bench_unrolled_list [N]
+#include <cstdio>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr int kReps = 5;
+
+template <typename List>
+void run(const char *label, std::size_t n) {
+  char name[64];
+  std::snprintf(name, sizeof(name), "%-17s %s", "push_back", label);
+  bench::isolated(name, [&] {
+    List l;
+    for (std::size_t i = 0; i < n; ++i) l.push_back(static_cast<int>(i));
+    bench::do_not_optimize(l.size());
+  });
+
+  List l;
+  for (std::size_t i = 0; i < n; ++i) l.push_back(static_cast<int>(i));
+  std::snprintf(name, sizeof(name), "%-17s %s", "scan", label);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  long long s = 0;
+                  for (int x : l) s += x;
+                  bench::do_not_optimize(s);
+                }),
+                n);
+
+  std::snprintf(name, sizeof(name), "%-17s %s", "insert after each", label);
+  bench::report(name, bench::best_of(1, [&] {
+                  for (auto it = l.begin(); it != l.end();) {
+                    ++it;
+                    it = l.insert(it, 0);
+                    ++it;
+                  }
+                  bench::do_not_optimize(l.size());
+                }),
+                n);
+  std::snprintf(name, sizeof(name), "%-17s %s", "scan afterwards", label);
+  bench::report(name, bench::best_of(kReps, [&] {
+                  long long s = 0;
+                  for (int x : l) s += x;
+                  bench::do_not_optimize(s);
+                }),
+                l.size());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 4000000);
+  std::printf("-- %zu ints, %zu per chunk\n", n,
+              s21::unrolled_list<int>::chunk_size);
+  run<s21::unrolled_list<int>>("unrolled_list", n);
+  run<s21::list<int>>("list", n);
+  return 0;
+}
@@ -0,0 +1,55 @@
+// Removing ~30% of the elements of an s21::vector: erase() per element vs
+// erase_if() compaction, plus unordered_erase() vs erase() at the front.
+// usage: bench_vector_erase [N]
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+s21::vector<int> make(std::size_t n) {
+  s21::vector<int> v;
+  v.resize(n);
+  for (std::size_t i = 0; i < n; ++i)
+    v[i] = static_cast<int>((i * 2654435761u) % 100);
+  return v;
+}
+
+bool doomed(int x) { return x < 30; }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 10000000);
+  // the per-element loop is quadratic, it only gets a slice of the input
+  const std::size_t slow_n = std::min<std::size_t>(n, 100000);
+
+  auto v = make(slow_n);
+  bench::timer t;
+  for (auto it = v.begin(); it != v.end();) {
+    if (doomed(*it))
+      it = v.erase(it);
+    else
+      ++it;
+  }
+  char name[64];
+  std::snprintf(name, sizeof(name), "erase loop (%zu)", slow_n);
+  bench::report(name, t.ms(), slow_n);
+
+  v = make(n);
+  t.reset();
+  v.erase_if(doomed);
+  std::snprintf(name, sizeof(name), "erase_if (%zu)", n);
+  bench::report(name, t.ms(), n);
+
+  v = make(slow_n);
+  t.reset();
+  while (!v.empty()) v.erase(v.begin());
+  bench::report("erase front until empty", t.ms(), slow_n);
+
+  v = make(slow_n);
+  t.reset();
+  while (!v.empty()) v.unordered_erase(v.begin());
+  bench::report("unordered_erase front until empty", t.ms(), slow_n);
+  return 0;
+}
@@ -0,0 +1,45 @@
+// Filling an s21::vector from another container: push_back loop vs range
+// insert / append_range vs resize_default_init + memcpy.
+// usage: bench_vector_fill [N]
+#include <cstring>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 20000000);
+  s21::vector<int> src;
+  src.resize(n);
+  for (std::size_t i = 0; i < n; ++i) src[i] = static_cast<int>(i);
+  std::printf("fill %zu ints from another vector\n", n);
+
+  bench::report("push_back loop", bench::best_of(3, [&] {
+                  s21::vector<int> v;
+                  for (auto it = src.begin(); it != src.end(); ++it)
+                    v.push_back(*it);
+                  bench::do_not_optimize(v.data());
+                }),
+                n);
+  bench::report("append_range", bench::best_of(3, [&] {
+                  s21::vector<int> v;
+                  v.append_range(src);
+                  bench::do_not_optimize(v.data());
+                }),
+                n);
+  bench::report("resize + copy", bench::best_of(3, [&] {
+                  s21::vector<int> v;
+                  v.resize(n);
+                  std::memcpy(v.data(), src.data(), n * sizeof(int));
+                  bench::do_not_optimize(v.data());
+                }),
+                n);
+  bench::report("resize_default_init + copy", bench::best_of(3, [&] {
+                  s21::vector<int> v;
+                  v.resize_default_init(n);
+                  std::memcpy(v.data(), src.data(), n * sizeof(int));
+                  bench::do_not_optimize(v.data());
+                }),
+                n);
+  return 0;
+}
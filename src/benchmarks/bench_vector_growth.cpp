@@ -0,0 +1,33 @@
+// Appends N ints with each growth policy and reports time and peak RSS.
+// usage: bench_vector_growth [N]   (N = 1000000000 for the 1B case)
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_common.h"
+
+template <typename Vector>
+void append(std::size_t n) {
+  Vector v;
+  for (std::size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+  bench::do_not_optimize(v[n / 2]);
+}
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::arg_size(argc, argv, 100000000);
+  std::printf("append %zu ints\n", n);
+  using heap = std::allocator<int>;
+  using mapped = s21::mmap_allocator<int>;
+  bench::isolated("std::allocator  grow x2",
+                  [n] { append<s21::vector<int, heap>>(n); });
+  bench::isolated("std::allocator  grow x1.5", [n] {
+    append<s21::vector<int, heap, s21::grow_one_and_half>>(n);
+  });
+  bench::isolated("mmap_allocator  grow x2",
+                  [n] { append<s21::vector<int, mapped>>(n); });
+  bench::isolated("mmap_allocator  grow x1.5", [n] {
+    append<s21::vector<int, mapped, s21::grow_one_and_half>>(n);
+  });
+  bench::isolated("mmap_allocator  grow +64Mi", [n] {
+    append<s21::vector<int, mapped, s21::grow_fixed<(1 << 26)>>>(n);
+  });
+  return 0;
+}
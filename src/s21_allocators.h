@@ -0,0 +1,508 @@
+#ifndef S21_ALLOCATORS_H
+#define S21_ALLOCATORS_H
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "s21_containers_common.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace s21 {
+
+namespace alloc_detail {
+
+inline std::size_t page_size() noexcept {
+#ifdef __linux__
+  static const std::size_t size =
+      static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  return size;
+#else
+  return 4096;
+#endif
+}
+
+inline std::size_t round_to_pages(std::size_t bytes) noexcept {
+  const std::size_t page = page_size();
+  return (bytes + page - 1) / page * page;
+}
+
+inline void *map_anonymous(std::size_t bytes, int extra_flags = 0) {
+#ifdef __linux__
+  void *p = mmap(nullptr, round_to_pages(bytes), PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | extra_flags, -1, 0);
+  if (p == MAP_FAILED) throw std::bad_alloc();
+  return p;
+#else
+  (void)extra_flags;
+  void *p = std::malloc(bytes);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+#endif
+}
+
+inline void unmap(void *p, std::size_t bytes) noexcept {
+#ifdef __linux__
+  munmap(p, round_to_pages(bytes));
+#else
+  (void)bytes;
+  std::free(p);
+#endif
+}
+
+// Resizes a mapping, letting the kernel move the page tables instead of
+// copying the contents.
+inline void *remap(void *p, std::size_t old_bytes, std::size_t new_bytes) {
+#ifdef __linux__
+  void *r = mremap(p, round_to_pages(old_bytes), round_to_pages(new_bytes),
+                   MREMAP_MAYMOVE);
+  if (r == MAP_FAILED) throw std::bad_alloc();
+  return r;
+#else
+  void *r = std::realloc(p, new_bytes);
+  if (r == nullptr) throw std::bad_alloc();
+  return r;
+#endif
+}
+
+// Maps at least bytes rounded up to a multiple of align, aligned to align.
+// The slack needed to find an aligned address is unmapped again.
+inline void *map_aligned(std::size_t bytes, std::size_t align,
+                         int extra_flags = 0) {
+#ifdef __linux__
+  const std::size_t len = (bytes + align - 1) / align * align;
+  char *raw = static_cast<char *>(map_anonymous(len + align, extra_flags));
+  const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(raw);
+  char *p = raw + ((align - addr % align) % align);
+  if (p != raw) munmap(raw, p - raw);
+  munmap(p + len, raw + align - p);
+  return p;
+#else
+  (void)align;
+  return map_anonymous(bytes, extra_flags);
+#endif
+}
+
+}  // namespace alloc_detail
+
+/*
+ * Allocator for large buffers of trivially copyable elements.
+ * Blocks smaller than Threshold bytes come from malloc, bigger ones are
+ * anonymous mappings. reallocate() grows a mapping with mremap(), so the
+ * kernel relinks the pages and nothing is copied; s21::vector uses it for
+ * trivially copyable T.
+ */
+template <typename T, std::size_t Threshold = (std::size_t{1} << 20)>
+class mmap_allocator {
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "mmap_allocator: over-aligned types are not supported");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = mmap_allocator<U, Threshold>;
+  };
+
+  static constexpr size_type threshold = Threshold;
+  // malloc alignment; mapped blocks are page aligned
+  static constexpr size_type alignment = alignof(std::max_align_t);
+
+  mmap_allocator() noexcept = default;
+  template <typename U>
+  mmap_allocator(const mmap_allocator<U, Threshold> &) noexcept {}
+
+  T *allocate(size_type n) {
+    const size_type bytes = n * sizeof(T);
+    if (mapped(bytes))
+      return static_cast<T *>(alloc_detail::map_anonymous(bytes));
+    void *p = std::malloc(bytes ? bytes : 1);
+    if (p == nullptr) throw std::bad_alloc();
+    return static_cast<T *>(p);
+  }
+
+  void deallocate(T *p, size_type n) noexcept {
+    const size_type bytes = n * sizeof(T);
+    if (mapped(bytes))
+      alloc_detail::unmap(p, bytes);
+    else
+      std::free(p);
+  }
+
+  // Resizes the block of old_n elements to new_n elements, preserving the
+  // first min(old_n, new_n) of them bytewise.
+  T *reallocate(T *p, size_type old_n, size_type new_n) {
+    const size_type old_bytes = old_n * sizeof(T);
+    const size_type new_bytes = new_n * sizeof(T);
+    if (mapped(old_bytes) && mapped(new_bytes))
+      return static_cast<T *>(alloc_detail::remap(p, old_bytes, new_bytes));
+    if (!mapped(old_bytes) && !mapped(new_bytes)) {
+      void *r = std::realloc(p, new_bytes ? new_bytes : 1);
+      if (r == nullptr) throw std::bad_alloc();
+      return static_cast<T *>(r);
+    }
+    T *r = allocate(new_n);
+    std::memcpy(static_cast<void *>(r), static_cast<const void *>(p),
+                old_bytes < new_bytes ? old_bytes : new_bytes);
+    deallocate(p, old_n);
+    return r;
+  }
+
+ private:
+  static bool mapped(size_type bytes) noexcept { return bytes >= Threshold; }
+};
+
+template <typename T, typename U, std::size_t N>
+bool operator==(const mmap_allocator<T, N> &,
+                const mmap_allocator<U, N> &) noexcept {
+  return true;
+}
+template <typename T, typename U, std::size_t N>
+bool operator!=(const mmap_allocator<T, N> &,
+                const mmap_allocator<U, N> &) noexcept {
+  return false;
+}
+
+enum class huge_page_mode {
+  transparent,  // madvise(MADV_HUGEPAGE)
+  prefault,     // MAP_POPULATE, all pages are faulted in by mmap()
+  transparent_prefault
+};
+
+/*
+ * Allocator for big, randomly accessed buffers.
+ * Blocks of at least Threshold bytes are 2 MiB aligned anonymous mappings
+ * advised as transparent huge pages and/or pre-faulted, so the request path
+ * neither misses the TLB as often nor stalls on first-touch page faults.
+ * Smaller blocks (and every list node) fall back to std::allocator, and when
+ * the kernel refuses huge pages the mapping silently stays on regular pages.
+ */
+template <typename T, std::size_t Threshold = (std::size_t{2} << 20),
+          huge_page_mode Mode = huge_page_mode::transparent>
+class huge_page_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = huge_page_allocator<U, Threshold, Mode>;
+  };
+
+  static constexpr size_type threshold = Threshold;
+  static constexpr size_type huge_page_size = std::size_t{2} << 20;
+
+  huge_page_allocator() noexcept = default;
+  template <typename U>
+  huge_page_allocator(
+      const huge_page_allocator<U, Threshold, Mode> &) noexcept {}
+
+  T *allocate(size_type n) {
+    const size_type bytes = n * sizeof(T);
+    if (bytes < Threshold) return std::allocator<T>().allocate(n);
+    const bool thp = Mode != huge_page_mode::prefault;
+    const bool prefault = Mode != huge_page_mode::transparent;
+    void *p = alloc_detail::map_aligned(bytes, huge_page_size,
+                                        prefault && !thp ? populate_flag : 0);
+#ifdef __linux__
+    const std::size_t len = mapped_length(bytes);
+    if (thp) madvise(p, len, MADV_HUGEPAGE);
+    if (thp && prefault) {
+      // faulting after the advice lets the kernel hand out huge pages
+      char *c = static_cast<char *>(p);
+      for (std::size_t off = 0; off < len; off += alloc_detail::page_size())
+        c[off] = 0;
+    }
+#endif
+    return static_cast<T *>(p);
+  }
+
+  void deallocate(T *p, size_type n) noexcept {
+    const size_type bytes = n * sizeof(T);
+    if (bytes < Threshold) {
+      std::allocator<T>().deallocate(p, n);
+      return;
+    }
+#ifdef __linux__
+    munmap(p, mapped_length(bytes));
+#else
+    std::free(p);
+#endif
+  }
+
+ private:
+#ifdef __linux__
+  static constexpr int populate_flag = MAP_POPULATE;
+#else
+  static constexpr int populate_flag = 0;
+#endif
+
+  static size_type mapped_length(size_type bytes) noexcept {
+    return (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+  }
+};
+
+template <typename T, typename U, std::size_t N, huge_page_mode M>
+bool operator==(const huge_page_allocator<T, N, M> &,
+                const huge_page_allocator<U, N, M> &) noexcept {
+  return true;
+}
+template <typename T, typename U, std::size_t N, huge_page_mode M>
+bool operator!=(const huge_page_allocator<T, N, M> &,
+                const huge_page_allocator<U, N, M> &) noexcept {
+  return false;
+}
+
+/*
+ * Allocator whose blocks start on an Alignment byte boundary, e.g. 32 for
+ * aligned AVX loads or 64 so that cache-line-sized records never straddle
+ * two lines. s21::vector reads the guarantee from `alignment` and exposes it
+ * through aligned_data().
+ */
+template <typename T, std::size_t Alignment = 64>
+class aligned_allocator {
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "aligned_allocator: alignment must be a power of two");
+  static_assert(Alignment >= alignof(T),
+                "aligned_allocator: alignment below the alignment of T");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Alignment>;
+  };
+
+  static constexpr size_type alignment = Alignment;
+
+  aligned_allocator() noexcept = default;
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Alignment> &) noexcept {}
+
+  T *allocate(size_type n) {
+    if (n > std::numeric_limits<size_type>::max() / sizeof(T))
+      throw std::bad_alloc();
+    return static_cast<T *>(
+        ::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+  }
+
+  void deallocate(T *p, size_type) noexcept {
+    ::operator delete(p, std::align_val_t(Alignment));
+  }
+};
+
+template <typename T, typename U, std::size_t A>
+bool operator==(const aligned_allocator<T, A> &,
+                const aligned_allocator<U, A> &) noexcept {
+  return true;
+}
+template <typename T, typename U, std::size_t A>
+bool operator!=(const aligned_allocator<T, A> &,
+                const aligned_allocator<U, A> &) noexcept {
+  return false;
+}
+
+/*
+ * Allocation counters shared by tracking allocators. Every operation is a
+ * relaxed atomic update, so one instance may be fed from several threads.
+ * The size histogram counts blocks per power of two: bucket b holds the
+ * requests of [2^(b-1), 2^b) bytes, bucket 0 the empty ones.
+ */
+class allocation_stats {
+ public:
+  static constexpr std::size_t buckets = 65;
+
+  allocation_stats() noexcept = default;
+  allocation_stats(const allocation_stats &) = delete;
+  allocation_stats &operator=(const allocation_stats &) = delete;
+
+  // counters of every tracking_allocator in the process
+  static allocation_stats &global() noexcept {
+    static allocation_stats stats;
+    return stats;
+  }
+
+  std::size_t allocations() const noexcept { return load(allocations_); }
+  std::size_t deallocations() const noexcept { return load(deallocations_); }
+  std::size_t reallocations() const noexcept { return load(reallocations_); }
+  // total bytes ever requested, reallocations counted with their new size
+  std::size_t allocated_bytes() const noexcept {
+    return load(allocated_bytes_);
+  }
+  std::size_t live_bytes() const noexcept {
+    return load(allocated_bytes_) - load(freed_bytes_);
+  }
+  std::size_t peak_bytes() const noexcept { return load(peak_bytes_); }
+  std::size_t histogram(std::size_t bucket) const noexcept {
+    return bucket < buckets ? load(histogram_[bucket]) : 0;
+  }
+
+  static std::size_t bucket_of(std::size_t bytes) noexcept {
+    std::size_t b = 0;
+    for (; bytes != 0; bytes >>= 1) ++b;
+    return b;
+  }
+
+  void on_allocate(std::size_t bytes) noexcept {
+    allocations_.fetch_add(1, std::memory_order_relaxed);
+    histogram_[bucket_of(bytes)].fetch_add(1, std::memory_order_relaxed);
+    add_allocated(bytes);
+  }
+
+  void on_deallocate(std::size_t bytes) noexcept {
+    deallocations_.fetch_add(1, std::memory_order_relaxed);
+    freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  void on_reallocate(std::size_t old_bytes, std::size_t new_bytes) noexcept {
+    reallocations_.fetch_add(1, std::memory_order_relaxed);
+    histogram_[bucket_of(new_bytes)].fetch_add(1, std::memory_order_relaxed);
+    freed_bytes_.fetch_add(old_bytes, std::memory_order_relaxed);
+    add_allocated(new_bytes);
+  }
+
+  // zeroes the counters; the byte total and the peak restart from the
+  // bytes still live
+  void reset() noexcept {
+    const std::size_t live = live_bytes();
+    allocations_.store(0, std::memory_order_relaxed);
+    deallocations_.store(0, std::memory_order_relaxed);
+    reallocations_.store(0, std::memory_order_relaxed);
+    allocated_bytes_.store(live, std::memory_order_relaxed);
+    freed_bytes_.store(0, std::memory_order_relaxed);
+    peak_bytes_.store(live, std::memory_order_relaxed);
+    for (auto &bucket : histogram_) bucket.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  using counter = std::atomic<std::size_t>;
+
+  // live bytes are allocated - freed, which keeps a deallocation at two
+  // atomic increments
+  counter allocations_{0}, deallocations_{0}, reallocations_{0};
+  counter allocated_bytes_{0}, freed_bytes_{0}, peak_bytes_{0};
+  counter histogram_[buckets] = {};
+
+  static std::size_t load(const counter &c) noexcept {
+    return c.load(std::memory_order_relaxed);
+  }
+
+  // Under contention the peak may briefly count a block another thread has
+  // already freed.
+  void add_allocated(std::size_t bytes) noexcept {
+    const std::size_t live =
+        allocated_bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes -
+        load(freed_bytes_);
+    std::size_t peak = load(peak_bytes_);
+    while (peak < live && !peak_bytes_.compare_exchange_weak(
+                              peak, live, std::memory_order_relaxed)) {
+    }
+  }
+};
+
+/*
+ * Allocator adapter that forwards to Base and records every allocation in
+ * its own allocation_stats and in allocation_stats::global(). Copies and
+ * rebinds of an allocator share its stats, so a container's node and buffer
+ * allocations land in one place: read them through
+ * container.get_allocator().stats(). A default-constructed allocator gets
+ * fresh stats; to group several containers, build one allocator from a
+ * shared_ptr and hand it to each container's allocator constructor.
+ * Containers swap and move the allocator with their storage, so per-instance
+ * counters stay balanced; splicing nodes between containers with different
+ * stats is not supported.
+ */
+template <typename T, typename Base = std::allocator<T>>
+class tracking_allocator {
+  using base_traits = std::allocator_traits<Base>;
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  template <typename U>
+  struct rebind {
+    using other = tracking_allocator<
+        U, typename base_traits::template rebind_alloc<U>>;
+  };
+
+  static constexpr size_type alignment = allocator_alignment<Base>::value;
+
+  tracking_allocator() : stats_(std::make_shared<allocation_stats>()) {}
+  explicit tracking_allocator(std::shared_ptr<allocation_stats> stats,
+                              const Base &base = Base())
+      : base_(base), stats_(std::move(stats)) {}
+  template <typename U, typename B>
+  tracking_allocator(const tracking_allocator<U, B> &other)
+      : base_(other.base()), stats_(other.shared_stats()) {}
+
+  T *allocate(size_type n) {
+    T *p = base_traits::allocate(base_, n);
+    stats_->on_allocate(n * sizeof(T));
+    allocation_stats::global().on_allocate(n * sizeof(T));
+    return p;
+  }
+
+  void deallocate(T *p, size_type n) noexcept {
+    base_traits::deallocate(base_, p, n);
+    stats_->on_deallocate(n * sizeof(T));
+    allocation_stats::global().on_deallocate(n * sizeof(T));
+  }
+
+  // only offered when Base can grow blocks in place (see mmap_allocator)
+  template <typename B = Base,
+            typename = std::enable_if_t<has_reallocate<B>::value>>
+  T *reallocate(T *p, size_type old_n, size_type new_n) {
+    T *r = base_.reallocate(p, old_n, new_n);
+    stats_->on_reallocate(old_n * sizeof(T), new_n * sizeof(T));
+    allocation_stats::global().on_reallocate(old_n * sizeof(T),
+                                             new_n * sizeof(T));
+    return r;
+  }
+
+  allocation_stats &stats() const noexcept { return *stats_; }
+  const std::shared_ptr<allocation_stats> &shared_stats() const noexcept {
+    return stats_;
+  }
+  const Base &base() const noexcept { return base_; }
+
+ private:
+  Base base_;
+  std::shared_ptr<allocation_stats> stats_;
+};
+
+template <typename T, typename B1, typename U, typename B2>
+bool operator==(const tracking_allocator<T, B1> &a,
+                const tracking_allocator<U, B2> &b) noexcept {
+  return a.shared_stats() == b.shared_stats();
+}
+template <typename T, typename B1, typename U, typename B2>
+bool operator!=(const tracking_allocator<T, B1> &a,
+                const tracking_allocator<U, B2> &b) noexcept {
+  return !(a == b);
+}
+
+}  // namespace s21
+
+#endif  // S21_ALLOCATORS_H
@@ -53,6 +53,7 @@ class array {
   const_reference back() const noexcept { return data_[size() - 1]; }
 
   iterator data() noexcept { return data_; }
+  const_iterator data() const noexcept { return data_; }
 
   /* Iterators */
   iterator begin() noexcept { return data_; }
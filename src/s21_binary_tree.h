@@ -32,11 +32,12 @@ struct KeyType<
  * of the subtrees of any node differ by no more than one.
  * Provides logarithmic search, insert, and delete operations.
  */
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class BinaryTree {
  public:
   using value_type = T;
   using Key = typename KeyType<T>::type;
+  using allocator_type = Allocator;
 
   struct Node {
     value_type data;
@@ -53,6 +54,14 @@ class BinaryTree {
           height(1) {}
   };
 
+ private:
+  // any allocator is rebound to the node type
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using a_traits = std::allocator_traits<node_allocator>;
+
+ public:
+
   template <bool is_const = false>
   /* A template class that handles both iterator and const_iterator through
    * std::conditional_t (a template utility in C++ that is used to select one of
@@ -68,7 +77,7 @@ class BinaryTree {
     // used by the standard library to determine the capabilities of an iterator
     using iterator_category = std::bidirectional_iterator_tag;
     using TreeType =
-        std::conditional_t<is_const, const BinaryTree<T>, BinaryTree<T>>;
+        std::conditional_t<is_const, const BinaryTree, BinaryTree>;
 
     // iterator traits for the iterator to be compatible with std containers
     using value_type = T;
@@ -173,12 +182,24 @@ class BinaryTree {
       : root_(nullptr),
         min_node_(nullptr),
         max_node_(nullptr),
-        end_node_(new Node(T{})),
+        end_node_(create_node(T{})),
+        size_(0) {}
+
+  // constructor allocating the nodes through a copy of alloc
+  explicit BinaryTree(const Allocator& alloc)
+      : alloc_(alloc),
+        root_(nullptr),
+        min_node_(nullptr),
+        max_node_(nullptr),
+        end_node_(create_node(T{})),
         size_(0) {}
 
   // copy constructor
   BinaryTree(const BinaryTree& other)
-      : root_(nullptr), end_node_(new Node(T{})), size_(0) {
+      : alloc_(a_traits::select_on_container_copy_construction(other.alloc_)),
+        root_(nullptr),
+        end_node_(create_node(T{})),
+        size_(0) {
     copy_tree(other.root_, nullptr);
     root_ = balance(root_);
     update_min_max_nodes();
@@ -188,11 +209,11 @@ class BinaryTree {
   // destructor
   ~BinaryTree() noexcept {
     clear_tree(root_);
-    delete end_node_;
+    if (end_node_) destroy_node(end_node_);
   }
 
   // move constructor
-  BinaryTree(BinaryTree&& other) noexcept {
+  BinaryTree(BinaryTree&& other) noexcept : alloc_(other.alloc_) {
     root_ = other.root_;
     min_node_ = other.min_node_;
     max_node_ = other.max_node_;
@@ -210,8 +231,9 @@ class BinaryTree {
   BinaryTree& operator=(BinaryTree&& other) {
     if (this != &other) {
       clear_tree(root_);
-      delete end_node_;
+      if (end_node_) destroy_node(end_node_);
 
+      alloc_ = other.alloc_;
       root_ = other.root_;
       min_node_ = other.min_node_;
       max_node_ = other.max_node_;
@@ -221,7 +243,7 @@ class BinaryTree {
       other.root_ = nullptr;
       other.min_node_ = nullptr;
       other.max_node_ = nullptr;
-      other.end_node_ = new Node(T{});
+      other.end_node_ = other.create_node(T{});
       other.size_ = 0;
     }
     return *this;
@@ -304,7 +326,7 @@ class BinaryTree {
         root_ = successor;
       successor->parent = node_to_remove->parent;
     }
-    delete node_to_remove;
+    destroy_node(node_to_remove);
     if (root_) {
       update_height(root_);
       root_ = balance(root_);
@@ -339,7 +361,10 @@ class BinaryTree {
 
   bool contains(const Key& key) const noexcept { return find(key) != end(); }
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
  protected:
+  node_allocator alloc_;
   Node* root_;
   Node* min_node_;
   Node* max_node_;
@@ -361,7 +386,7 @@ class BinaryTree {
     std::pair<Node*, bool> result = {node, false};
     if (!node) {
       // Base case: create a new node
-      result.first = new Node(value);
+      result.first = create_node(value);
       result.second = true;
     } else {
       if (std::less<Key>()(extract_key(value), extract_key(node->data))) {
@@ -411,7 +436,7 @@ class BinaryTree {
 
   Node* copy_tree(Node* other_node, Node* parent) {
     if (!other_node) return nullptr;
-    Node* new_node = new Node(other_node->data);
+    Node* new_node = create_node(other_node->data);
     new_node->parent = parent;
     if (!parent) root_ = new_node;
     new_node->left = copy_tree(other_node->left, new_node);
@@ -424,8 +449,24 @@ class BinaryTree {
     if (node) {
       clear_tree(node->left);
       clear_tree(node->right);
-      delete node;
+      destroy_node(node);
+    }
+  }
+
+  Node* create_node(const value_type& value) {
+    Node* node = a_traits::allocate(alloc_, 1);
+    try {
+      a_traits::construct(alloc_, node, value);
+    } catch (...) {
+      a_traits::deallocate(alloc_, node, 1);
+      throw;
     }
+    return node;
+  }
+
+  void destroy_node(Node* node) noexcept {
+    a_traits::destroy(alloc_, node);
+    a_traits::deallocate(alloc_, node, 1);
   }
 
   Node* rotate_right(Node* old_root) {
@@ -0,0 +1,281 @@
+#ifndef S21_BLOCKING_QUEUE_H
+#define S21_BLOCKING_QUEUE_H
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+
+#include "s21_ring_buffer.h"
+
+namespace s21 {
+
+// Outcome of a blocking_queue operation that can fail without an error.
+enum class queue_op_status {
+  success,
+  // try_push on a full queue
+  full,
+  // try_pop on an empty queue
+  empty,
+  // push_for/pop_for ran out of time
+  timeout,
+  // pushing into a closed queue, or popping from a closed and drained one
+  closed
+};
+
+/*
+ * Bounded FIFO for producer/consumer pipelines: a mutex, a ring_buffer and
+ * two condition variables, with the waiting done by the queue. Pushing
+ * into a full queue blocks the producer (backpressure), popping from an
+ * empty one blocks the consumer; the _for variants give up after a
+ * timeout and the try_ ones never wait. pop_batch drains up to max
+ * elements per wake-up.
+ *
+ * Wake-ups are coalesced: the queue counts the threads waiting on each
+ * side and the signals already sent to them, and a push notifies only
+ * while some waiting consumer has no wake-up on its way. A burst of
+ * pushes into a queue with one sleeping consumer thus costs one notify,
+ * not one per element. Pops wake producers the same way, a batch up to
+ * one per freed slot.
+ *
+ * close() ends the stream: pushes fail with queue_op_status::closed and
+ * pops return the remaining elements, then closed.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class blocking_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+ private:
+  // threads blocked on one condition, and how many of them have been
+  // signalled but have not woken up yet
+  struct sleepers {
+    std::condition_variable cv;
+    size_type waiting = 0;
+    size_type signalled = 0;
+
+    // under the lock: how many of up to n wake-ups are worth sending
+    size_type claim(size_type n) noexcept {
+      const size_type idle = waiting - signalled;
+      if (n > idle) n = idle;
+      signalled += n;
+      return n;
+    }
+    // after unlocking
+    void notify(size_type n) {
+      for (; n > 0; --n) cv.notify_one();
+    }
+  };
+
+  mutable std::mutex mutex_;
+  sleepers consumers_;
+  sleepers producers_;
+  ring_buffer<T, Allocator> items_;
+  size_type capacity_;
+  bool closed_ = false;
+
+ public:
+  /* Member functions */
+  // queue holding at most capacity elements
+  explicit blocking_queue(size_type capacity) : capacity_(capacity) {
+    if (capacity == 0) throw std::length_error("blocking_queue: zero capacity");
+  }
+
+  // threads hold references to the queue, it never moves
+  blocking_queue(const blocking_queue &) = delete;
+  blocking_queue &operator=(const blocking_queue &) = delete;
+
+  /* Capacity */
+  size_type capacity() const noexcept { return capacity_; }
+  size_type size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return items_.size();
+  }
+  bool empty() const { return size() == 0; }
+
+  /* Closing */
+  // wakes every waiting thread; later pushes fail, pops drain what is left
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      consumers_.signalled = consumers_.waiting;
+      producers_.signalled = producers_.waiting;
+    }
+    consumers_.cv.notify_all();
+    producers_.cv.notify_all();
+  }
+
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+
+  /* Producer */
+  // waits for room; success or closed
+  queue_op_status push(const_reference value) { return emplace(value); }
+  queue_op_status push(value_type &&value) { return emplace(std::move(value)); }
+
+  template <typename... Args>
+  queue_op_status emplace(Args &&...args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait_for_room(lock, nullptr);
+    return put(lock, std::forward<Args>(args)...);
+  }
+
+  // success, full or closed
+  queue_op_status try_push(const_reference value) {
+    return try_emplace(value);
+  }
+  queue_op_status try_push(value_type &&value) {
+    return try_emplace(std::move(value));
+  }
+
+  template <typename... Args>
+  queue_op_status try_emplace(Args &&...args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!closed_ && items_.size() == capacity_) return queue_op_status::full;
+    return put(lock, std::forward<Args>(args)...);
+  }
+
+  // waits at most timeout for room; success, timeout or closed
+  template <typename Rep, typename Period>
+  queue_op_status push_for(const_reference value,
+                           const std::chrono::duration<Rep, Period> &timeout) {
+    return emplace_until(deadline(timeout), value);
+  }
+  template <typename Rep, typename Period>
+  queue_op_status push_for(value_type &&value,
+                           const std::chrono::duration<Rep, Period> &timeout) {
+    return emplace_until(deadline(timeout), std::move(value));
+  }
+
+  /* Consumer */
+  // waits for an element; success or closed
+  queue_op_status pop(reference out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait_for_items(lock, nullptr);
+    return take(lock, out);
+  }
+
+  // success, empty or closed
+  queue_op_status try_pop(reference out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!closed_ && items_.empty()) return queue_op_status::empty;
+    return take(lock, out);
+  }
+
+  // waits at most timeout for an element; success, timeout or closed
+  template <typename Rep, typename Period>
+  queue_op_status pop_for(reference out,
+                          const std::chrono::duration<Rep, Period> &timeout) {
+    const auto until = deadline(timeout);
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!wait_for_items(lock, &until)) return queue_op_status::timeout;
+    return take(lock, out);
+  }
+
+  // Waits at most timeout for the queue to become non-empty, then moves up
+  // to max elements to out under one lock and one wake-up. Returns how
+  // many; 0 after a timeout or once the queue is closed and drained.
+  template <typename OutputIt, typename Rep, typename Period>
+  size_type pop_batch(OutputIt out, size_type max,
+                      const std::chrono::duration<Rep, Period> &timeout) {
+    const auto until = deadline(timeout);
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (max == 0 || !wait_for_items(lock, &until)) return 0;
+    size_type count = 0;
+    for (; count < max && !items_.empty(); ++count, ++out) {
+      *out = std::move_if_noexcept(items_.front());
+      items_.pop_front();
+    }
+    const size_type wake = producers_.claim(count);
+    lock.unlock();
+    producers_.notify(wake);
+    return count;
+  }
+
+ private:
+  using clock = std::chrono::steady_clock;
+
+  template <typename Rep, typename Period>
+  static clock::time_point deadline(
+      const std::chrono::duration<Rep, Period> &timeout) {
+    return clock::now() +
+           std::chrono::duration_cast<clock::duration>(timeout);
+  }
+
+  template <typename... Args>
+  queue_op_status emplace_until(clock::time_point until, Args &&...args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!wait_for_room(lock, &until)) return queue_op_status::timeout;
+    return put(lock, std::forward<Args>(args)...);
+  }
+
+  // Waits until there is room or the queue is closed; false on reaching
+  // *until first. A null until waits for ever.
+  bool wait_for_room(std::unique_lock<std::mutex> &lock,
+                     const clock::time_point *until) {
+    return wait(lock, producers_, until,
+                [&] { return closed_ || items_.size() < capacity_; });
+  }
+
+  // the same for an element to pop
+  bool wait_for_items(std::unique_lock<std::mutex> &lock,
+                      const clock::time_point *until) {
+    return wait(lock, consumers_, until,
+                [&] { return closed_ || !items_.empty(); });
+  }
+
+  // Every wake-up, signalled or not, retires one signal: undercounting
+  // only costs a redundant notify, overcounting could lose one.
+  template <typename Ready>
+  static bool wait(std::unique_lock<std::mutex> &lock, sleepers &s,
+                   const clock::time_point *until, Ready ready) {
+    if (ready()) return true;
+    ++s.waiting;
+    bool timed_out = false;
+    do {
+      if (until == nullptr)
+        s.cv.wait(lock);
+      else
+        timed_out =
+            s.cv.wait_until(lock, *until) == std::cv_status::timeout;
+      if (s.signalled > 0) --s.signalled;
+    } while (!ready() && !timed_out);
+    --s.waiting;
+    if (s.signalled > s.waiting) s.signalled = s.waiting;
+    return ready();
+  }
+
+  // pushes under lock once there is room, then signals a consumer unless
+  // every waiting one already has a wake-up on the way
+  template <typename... Args>
+  queue_op_status put(std::unique_lock<std::mutex> &lock, Args &&...args) {
+    if (closed_) return queue_op_status::closed;
+    items_.emplace_back(std::forward<Args>(args)...);
+    const size_type wake = consumers_.claim(1);
+    lock.unlock();
+    consumers_.notify(wake);
+    return queue_op_status::success;
+  }
+
+  // pops under lock once there is an element or the queue is closed
+  queue_op_status take(std::unique_lock<std::mutex> &lock, reference out) {
+    if (items_.empty()) return queue_op_status::closed;
+    out = std::move_if_noexcept(items_.front());
+    items_.pop_front();
+    const size_type wake = producers_.claim(1);
+    lock.unlock();
+    producers_.notify(wake);
+    return queue_op_status::success;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_BLOCKING_QUEUE_H
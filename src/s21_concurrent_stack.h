@@ -0,0 +1,375 @@
+#ifndef S21_CONCURRENT_STACK_H
+#define S21_CONCURRENT_STACK_H
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <thread>
+
+#include "s21_containers_common.h"
+
+namespace s21 {
+
+namespace stack_detail {
+
+// A node pointer and a modification counter packed into one word, so that
+// a single-word CAS detects a head that was popped and pushed back in the
+// meantime (ABA). 64-bit targets keep the pointer in the low 48 bits.
+class tagged_ptr {
+  static constexpr int kPointerBits = sizeof(void *) == 8 ? 48 : 32;
+  static constexpr std::uint64_t kPointerMask =
+      (std::uint64_t{1} << kPointerBits) - 1;
+
+  std::uint64_t word_ = 0;
+
+  explicit tagged_ptr(std::uint64_t word) noexcept : word_(word) {}
+
+ public:
+  tagged_ptr() noexcept = default;
+  tagged_ptr(void *ptr, std::uint64_t tag) noexcept
+      : word_(reinterpret_cast<std::uintptr_t>(ptr) |
+              (tag << kPointerBits)) {
+    assert((reinterpret_cast<std::uintptr_t>(ptr) & ~kPointerMask) == 0 &&
+           "tagged_ptr: address does not fit");
+  }
+
+  template <typename Node>
+  Node *get() const noexcept {
+    return reinterpret_cast<Node *>(
+        static_cast<std::uintptr_t>(word_ & kPointerMask));
+  }
+  std::uint64_t tag() const noexcept { return word_ >> kPointerBits; }
+  // the same counter bumped, pointing at ptr
+  tagged_ptr next(void *ptr) const noexcept { return {ptr, tag() + 1}; }
+
+  std::uint64_t word() const noexcept { return word_; }
+  static tagged_ptr from_word(std::uint64_t word) noexcept {
+    return tagged_ptr(word);
+  }
+};
+
+// Lock-free LIFO of intrusive nodes with a tagged head: the core of both
+// the stack and its node pool. Node needs an std::atomic<Node *> next.
+template <typename Node>
+class tagged_stack {
+  alignas(cache_line_size) std::atomic<std::uint64_t> head_{0};
+
+ public:
+  bool empty() const noexcept {
+    return tagged_ptr::from_word(head_.load(std::memory_order_acquire))
+               .template get<Node>() == nullptr;
+  }
+
+  // links the chain first..last, first on top, with one CAS
+  void push(Node *first, Node *last) noexcept {
+    while (!try_push(first, last)) {
+    }
+  }
+
+  // one push attempt, false when another thread changed the head
+  bool try_push(Node *first, Node *last) noexcept {
+    std::uint64_t word = head_.load(std::memory_order_relaxed);
+    const tagged_ptr head = tagged_ptr::from_word(word);
+    last->next.store(head.get<Node>(), std::memory_order_relaxed);
+    return head_.compare_exchange_strong(word, head.next(first).word(),
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed);
+  }
+
+  // unlinks the top node, nullptr when empty
+  Node *pop() noexcept {
+    Node *top;
+    while (!try_pop(top)) {
+    }
+    return top;
+  }
+
+  // One pop attempt: false when another thread changed the head, else
+  // top is the unlinked node or nullptr for an empty stack. Reading next
+  // of a node that another thread has just popped is safe because nodes
+  // are only recycled, never freed, while the stack lives; the tag makes
+  // the CAS reject the stale value.
+  bool try_pop(Node *&top) noexcept {
+    std::uint64_t word = head_.load(std::memory_order_acquire);
+    const tagged_ptr head = tagged_ptr::from_word(word);
+    top = head.get<Node>();
+    if (top == nullptr) return true;
+    Node *next = top->next.load(std::memory_order_relaxed);
+    return head_.compare_exchange_strong(word, head.next(next).word(),
+                                         std::memory_order_acquire,
+                                         std::memory_order_relaxed);
+  }
+
+  // unlinks the whole chain, nullptr when empty
+  Node *pop_all() noexcept {
+    std::uint64_t word = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      const tagged_ptr head = tagged_ptr::from_word(word);
+      if (head.get<Node>() == nullptr) return nullptr;
+      if (head_.compare_exchange_weak(word, head.next(nullptr).word(),
+                                      std::memory_order_acquire,
+                                      std::memory_order_relaxed))
+        return head.get<Node>();
+    }
+  }
+};
+
+}  // namespace stack_detail
+
+/*
+ * Lock-free LIFO for any number of threads (Treiber stack): push and pop
+ * are a CAS on the head, which packs a modification counter next to the
+ * pointer against ABA. Popped nodes go to an internal pool, itself a
+ * lock-free stack, and are reused by later pushes; they are returned to
+ * the allocator only by the destructor, which is what makes the lock-free
+ * pop memory safe without hazard pointers.
+ *
+ * Constructed with elimination_slots > 0, a push or pop that loses the
+ * head CAS first tries to meet an operation of the other kind in a small
+ * array of exchange slots: a push parks its node in a slot for a short
+ * spin and a pop that finds it takes it, so matching pairs cancel out
+ * without touching the head at all under heavy contention.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class concurrent_stack {
+  struct node {
+    std::atomic<node *> next{nullptr};
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T *value() noexcept {
+      return std::launder(reinterpret_cast<T *>(storage));
+    }
+  };
+
+  // a tagged node pointer, so that a push that parked a node cannot
+  // withdraw it after a pop took it and the node came back recycled
+  struct alignas(cache_line_size) exchange_slot {
+    std::atomic<std::uint64_t> offer{0};
+  };
+
+  using a_traits = std::allocator_traits<Allocator>;
+  using node_allocator = typename a_traits::template rebind_alloc<node>;
+  using n_traits = std::allocator_traits<node_allocator>;
+  using slot_allocator =
+      typename a_traits::template rebind_alloc<exchange_slot>;
+  using s_traits = std::allocator_traits<slot_allocator>;
+
+  static constexpr int kOfferSpins = 256;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+ private:
+  Allocator alloc_;
+  node_allocator node_alloc_;
+  slot_allocator slot_alloc_;
+  exchange_slot *slots_ = nullptr;
+  size_type slot_count_ = 0;
+
+  stack_detail::tagged_stack<node> items_;
+  stack_detail::tagged_stack<node> pool_;
+
+ public:
+  /* Member functions */
+  // elimination_slots = 0 turns elimination off
+  explicit concurrent_stack(size_type elimination_slots = 0,
+                            const Allocator &alloc = Allocator())
+      : alloc_(alloc), node_alloc_(alloc), slot_alloc_(alloc) {
+    if (elimination_slots > 0) {
+      slots_ = s_traits::allocate(slot_alloc_, elimination_slots);
+      for (size_type i = 0; i < elimination_slots; ++i)
+        s_traits::construct(slot_alloc_, slots_ + i);
+      slot_count_ = elimination_slots;
+    }
+  }
+
+  // threads hold references to the stack, it never moves
+  concurrent_stack(const concurrent_stack &) = delete;
+  concurrent_stack &operator=(const concurrent_stack &) = delete;
+
+  ~concurrent_stack() {
+    release(items_.pop_all(), true);
+    release(pool_.pop_all(), false);
+    if (slots_ != nullptr)
+      s_traits::deallocate(slot_alloc_, slots_, slot_count_);
+  }
+
+  /* Capacity */
+  // approximate while other threads push or pop
+  bool empty() const noexcept { return items_.empty(); }
+
+  /* Modifiers */
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    node *n = make_node(std::forward<Args>(args)...);
+    if (slot_count_ == 0)
+      items_.push(n, n);
+    else
+      while (!items_.try_push(n, n) && !offer(n)) {
+      }
+  }
+
+  // moves the top element into out, false when the stack is empty
+  bool try_pop(reference out) {
+    node *n;
+    if (slot_count_ == 0)
+      n = items_.pop();
+    else
+      while (!items_.try_pop(n) && (n = take_offer()) == nullptr) {
+      }
+    if (n == nullptr) return false;
+    try {
+      out = std::move_if_noexcept(*n->value());
+    } catch (...) {
+      items_.push(n, n);
+      throw;
+    }
+    recycle(n);
+    return true;
+  }
+
+  // Pushes the range [first, last) with a single CAS, so the elements
+  // appear together, last one on top. If a copy throws, nothing is pushed.
+  template <typename InputIt>
+  void push_chain(InputIt first, InputIt last) {
+    node *top = nullptr, *bottom = nullptr;
+    try {
+      for (; first != last; ++first) {
+        node *n = make_node(*first);
+        n->next.store(top, std::memory_order_relaxed);
+        if (bottom == nullptr) bottom = n;
+        top = n;
+      }
+    } catch (...) {
+      // other threads may still read these nodes if they came from the
+      // pool, so they go back there rather than to the allocator
+      if (top != nullptr) {
+        for (node *n = top; n != nullptr;
+             n = n->next.load(std::memory_order_relaxed))
+          a_traits::destroy(alloc_, n->value());
+        pool_.push(top, bottom);
+      }
+      throw;
+    }
+    if (top != nullptr) items_.push(top, bottom);
+  }
+
+  // Detaches every element with a single exchange and moves them to out,
+  // top first; returns how many.
+  template <typename OutputIt>
+  size_type pop_all(OutputIt out) {
+    node *n = items_.pop_all();
+    size_type count = 0;
+    try {
+      for (; n != nullptr; ++count, ++out) {
+        node *next = n->next.load(std::memory_order_relaxed);
+        *out = std::move_if_noexcept(*n->value());
+        recycle(n);
+        n = next;
+      }
+    } catch (...) {
+      // the rest goes back on top, in the same order
+      node *bottom = n;
+      while (bottom->next.load(std::memory_order_relaxed) != nullptr)
+        bottom = bottom->next.load(std::memory_order_relaxed);
+      items_.push(n, bottom);
+      throw;
+    }
+    return count;
+  }
+
+ private:
+  template <typename... Args>
+  node *make_node(Args &&...args) {
+    node *n = pool_.pop();
+    if (n == nullptr) {
+      n = n_traits::allocate(node_alloc_, 1);
+      n_traits::construct(node_alloc_, n);
+    }
+    try {
+      a_traits::construct(alloc_, n->value(), std::forward<Args>(args)...);
+    } catch (...) {
+      pool_.push(n, n);
+      throw;
+    }
+    return n;
+  }
+
+  void recycle(node *n) noexcept {
+    a_traits::destroy(alloc_, n->value());
+    pool_.push(n, n);
+  }
+
+  // Frees a detached chain, destroying the values when it holds elements.
+  // Only the destructor may call it: until then a node can be read by a
+  // concurrent try_pop.
+  void release(node *n, bool with_values) noexcept {
+    while (n != nullptr) {
+      node *next = n->next.load(std::memory_order_relaxed);
+      if (with_values) a_traits::destroy(alloc_, n->value());
+      n_traits::destroy(node_alloc_, n);
+      n_traits::deallocate(node_alloc_, n, 1);
+      n = next;
+    }
+  }
+
+  exchange_slot &random_slot() noexcept {
+    thread_local std::uint32_t x =
+        static_cast<std::uint32_t>(
+            std::hash<std::thread::id>()(std::this_thread::get_id())) |
+        1;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return slots_[x % slot_count_];
+  }
+
+  // parks n in a slot for a while; true when a pop took it
+  bool offer(node *n) noexcept {
+    using stack_detail::tagged_ptr;
+    exchange_slot &slot = random_slot();
+    std::uint64_t word = slot.offer.load(std::memory_order_relaxed);
+    const tagged_ptr empty = tagged_ptr::from_word(word);
+    if (empty.get<node>() != nullptr) return false;
+    const std::uint64_t parked = empty.next(n).word();
+    if (!slot.offer.compare_exchange_strong(word, parked,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed))
+      return false;
+    for (int i = 0; i < kOfferSpins; ++i) {
+      if (slot.offer.load(std::memory_order_relaxed) != parked) return true;
+      cpu_relax();
+    }
+    word = parked;
+    // a failed withdrawal means a pop got there first
+    return !slot.offer.compare_exchange_strong(
+        word, tagged_ptr::from_word(parked).next(nullptr).word(),
+        std::memory_order_relaxed);
+  }
+
+  // takes a node some push parked in a slot, nullptr when none was there
+  node *take_offer() noexcept {
+    using stack_detail::tagged_ptr;
+    exchange_slot &slot = random_slot();
+    std::uint64_t word = slot.offer.load(std::memory_order_acquire);
+    const tagged_ptr parked = tagged_ptr::from_word(word);
+    node *n = parked.get<node>();
+    if (n != nullptr &&
+        slot.offer.compare_exchange_strong(word, parked.next(nullptr).word(),
+                                           std::memory_order_acquire))
+      return n;
+    return nullptr;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_CONCURRENT_STACK_H
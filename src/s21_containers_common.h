@@ -3,10 +3,66 @@
 
 #include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace s21 {
 
+// Detects allocators that can resize a block in place:
+// `T *reallocate(T *p, size_t old_n, size_t new_n)`
+template <typename A, typename = void>
+struct has_reallocate : std::false_type {};
+
+template <typename A>
+struct has_reallocate<
+    A, std::void_t<decltype(std::declval<A &>().reallocate(
+           std::declval<typename A::value_type *>(), std::size_t{},
+           std::size_t{}))>> : std::true_type {};
+
+// Detect the front-end operations that the stack and queue adapters use
+// when the container has them, falling back to insert/erase at begin().
+template <typename C, typename = void>
+struct has_push_front : std::false_type {};
+
+template <typename C>
+struct has_push_front<C, std::void_t<decltype(std::declval<C &>().push_front(
+                             std::declval<typename C::value_type>()))>>
+    : std::true_type {};
+
+template <typename C, typename = void>
+struct has_pop_front : std::false_type {};
+
+template <typename C>
+struct has_pop_front<C, std::void_t<decltype(std::declval<C &>().pop_front())>>
+    : std::true_type {};
+
+// Alignment an allocator guarantees for its blocks: A::alignment when it
+// declares one, the element alignment otherwise
+template <typename A, typename = void>
+struct allocator_alignment
+    : std::integral_constant<std::size_t, alignof(typename A::value_type)> {};
+
+template <typename A>
+struct allocator_alignment<A, std::void_t<decltype(A::alignment)>>
+    : std::integral_constant<std::size_t, A::alignment> {};
+
+// Size assumed for a cache line when padding data shared between threads.
+// std::hardware_destructive_interference_size is not available everywhere
+// and warns about ABI stability where it is.
+inline constexpr std::size_t cache_line_size = 64;
+
+// Hint for the body of a spin-wait loop: lets the sibling hyperthread run
+// and saves power without giving up the time slice.
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
 // Common interface for s21 containers
 struct s21_container {
   virtual ~s21_container() {};
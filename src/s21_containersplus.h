@@ -7,7 +7,23 @@
 #include <utility>
 // #include <cstddef>
 
+#include "s21_allocators.h"
+#include "s21_blocking_queue.h"
+#include "s21_concurrent_stack.h"
+#include "s21_deque.h"
+#include "s21_dynamic_bitset.h"
+#include "s21_intrusive_list.h"
+#include "s21_mmap_vector.h"
+#include "s21_mpmc_queue.h"
 #include "s21_array.h"
 #include "s21_multiset.h"
+#include "s21_parallel_sort.h"
+#include "s21_priority_queue.h"
+#include "s21_ring_buffer.h"
+#include "s21_simd.h"
+#include "s21_soa_vector.h"
+#include "s21_span.h"
+#include "s21_spsc_queue.h"
+#include "s21_unrolled_list.h"
 
 #endif
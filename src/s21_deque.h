@@ -0,0 +1,377 @@
+#ifndef S21_DEQUE_H
+#define S21_DEQUE_H
+#pragma once
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+#include "s21_containers_common.h"
+
+namespace s21 {
+
+// Elements per deque block: about 4 KiB worth, at least 16, a power of two
+// so that an index splits into block and offset with a shift and a mask.
+template <typename T>
+constexpr std::size_t deque_block_size() noexcept {
+  std::size_t n = 16;
+  while (n * 2 * sizeof(T) <= 4096) n *= 2;
+  return n;
+}
+
+template <typename T>
+constexpr unsigned deque_block_shift() noexcept {
+  unsigned shift = 0;
+  while ((std::size_t{1} << shift) < deque_block_size<T>()) ++shift;
+  return shift;
+}
+
+template <typename T, bool is_const = false>
+class DequeIterator_base {
+ public:
+  using pointer = std::conditional_t<is_const, const T *, T *>;
+  using reference = std::conditional_t<is_const, const T &, T &>;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+
+ private:
+  static constexpr unsigned shift = deque_block_shift<T>();
+  static constexpr std::size_t mask = deque_block_size<T>() - 1;
+
+  T *const *map_;
+  std::size_t pos_;
+
+ public:
+  DequeIterator_base(T *const *map, std::size_t pos) noexcept
+      : map_(map), pos_(pos) {}
+  // iterator -> const_iterator conversion
+  template <bool c = is_const, typename = std::enable_if_t<c>>
+  DequeIterator_base(const DequeIterator_base<T, false> &other) noexcept
+      : map_(other.map()), pos_(other.position()) {}
+
+  reference operator*() const noexcept {
+    return map_[pos_ >> shift][pos_ & mask];
+  }
+  pointer operator->() const noexcept { return &**this; }
+  reference operator[](difference_type n) const noexcept {
+    return *(*this + n);
+  }
+
+  DequeIterator_base &operator++() noexcept {
+    ++pos_;
+    return *this;
+  }
+  DequeIterator_base operator++(int) noexcept {
+    return DequeIterator_base(map_, pos_++);
+  }
+  DequeIterator_base &operator--() noexcept {
+    --pos_;
+    return *this;
+  }
+  DequeIterator_base operator--(int) noexcept {
+    return DequeIterator_base(map_, pos_--);
+  }
+  DequeIterator_base &operator+=(difference_type n) noexcept {
+    pos_ += n;
+    return *this;
+  }
+  DequeIterator_base &operator-=(difference_type n) noexcept {
+    pos_ -= n;
+    return *this;
+  }
+  DequeIterator_base operator+(difference_type n) const noexcept {
+    return DequeIterator_base(map_, pos_ + n);
+  }
+  DequeIterator_base operator-(difference_type n) const noexcept {
+    return DequeIterator_base(map_, pos_ - n);
+  }
+  difference_type operator-(const DequeIterator_base &other) const noexcept {
+    return static_cast<difference_type>(pos_ - other.pos_);
+  }
+
+  bool operator==(const DequeIterator_base &other) const noexcept {
+    return pos_ == other.pos_;
+  }
+  bool operator!=(const DequeIterator_base &other) const noexcept {
+    return !(*this == other);
+  }
+  bool operator<(const DequeIterator_base &other) const noexcept {
+    return pos_ < other.pos_;
+  }
+  bool operator>(const DequeIterator_base &other) const noexcept {
+    return other < *this;
+  }
+
+  T *const *map() const noexcept { return map_; }
+  std::size_t position() const noexcept { return pos_; }
+};
+
+/*
+ * Double-ended queue made of fixed-size blocks of block_size elements and a
+ * map of block pointers. Elements are never moved once constructed: growing
+ * at either end allocates a block or, when the map runs out of slots,
+ * recentres or doubles the map of pointers only. push/pop at both ends are
+ * O(1) and keep references to the other elements valid; iterators are
+ * invalidated by pushes. Emptied blocks stay in the map and are reused, so a
+ * deque used as a FIFO stops allocating once it reaches its working size.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class deque : public s21_sequence_container {
+  using a_traits = std::allocator_traits<Allocator>;
+  using map_allocator = typename a_traits::template rebind_alloc<T *>;
+  using m_traits = std::allocator_traits<map_allocator>;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = DequeIterator_base<T, false>;
+  using const_iterator = DequeIterator_base<T, true>;
+  using allocator_type = Allocator;
+
+  static constexpr size_type block_size = deque_block_size<T>();
+
+ private:
+  static constexpr unsigned shift = deque_block_shift<T>();
+  static constexpr size_type mask = block_size - 1;
+
+  Allocator alloc_;
+  map_allocator map_alloc_{alloc_};
+  T **map_ = nullptr;
+  size_type map_cap_ = 0;
+  // position of the first element, counted from the start of map_[0]
+  size_type head_ = 0;
+  size_type size_ = 0;
+
+ public:
+  /* Member functions */
+  deque() = default;
+
+  // allocates the blocks and the map through copies of alloc
+  explicit deque(const Allocator &alloc) : alloc_(alloc), map_alloc_(alloc_) {}
+
+  deque(std::initializer_list<value_type> const &items,
+        const Allocator &alloc = Allocator())
+      : deque(alloc) {
+    for (const auto &item : items) push_back(item);
+  }
+
+  deque(const deque &other)
+      : alloc_(a_traits::select_on_container_copy_construction(other.alloc_)),
+        map_alloc_(alloc_) {
+    for (const auto &item : other) push_back(item);
+  }
+
+  deque(deque &&other) noexcept { swap(other); }
+
+  ~deque() {
+    clear();
+    for (size_type b = 0; b < map_cap_; ++b)
+      if (map_[b] != nullptr) a_traits::deallocate(alloc_, map_[b], block_size);
+    if (map_ != nullptr) m_traits::deallocate(map_alloc_, map_, map_cap_);
+  }
+
+  deque &operator=(const deque &other) {
+    if (this != &other) {
+      deque copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  deque &operator=(deque &&other) noexcept {
+    if (this != &other) swap(other);
+    return *this;
+  }
+
+  /* Element access */
+  reference operator[](size_type i) noexcept { return slot(head_ + i); }
+  const_reference operator[](size_type i) const noexcept {
+    return slot(head_ + i);
+  }
+
+  reference at(size_type i) {
+    if (i >= size_) throw std::out_of_range("deque: out of range");
+    return (*this)[i];
+  }
+  const_reference at(size_type i) const {
+    if (i >= size_) throw std::out_of_range("deque: out of range");
+    return (*this)[i];
+  }
+
+  reference front() {
+    if (empty()) throw std::out_of_range("deque: deque is empty");
+    return slot(head_);
+  }
+  const_reference front() const {
+    if (empty()) throw std::out_of_range("deque: deque is empty");
+    return slot(head_);
+  }
+  reference back() {
+    if (empty()) throw std::out_of_range("deque: deque is empty");
+    return slot(head_ + size_ - 1);
+  }
+  const_reference back() const {
+    if (empty()) throw std::out_of_range("deque: deque is empty");
+    return slot(head_ + size_ - 1);
+  }
+
+  /* Iterators */
+  iterator begin() noexcept { return iterator(map_, head_); }
+  iterator end() noexcept { return iterator(map_, head_ + size_); }
+  const_iterator begin() const noexcept { return const_iterator(map_, head_); }
+  const_iterator end() const noexcept {
+    return const_iterator(map_, head_ + size_);
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  /* Capacity */
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(T) / 2;
+  }
+  Allocator get_allocator() const { return alloc_; }
+
+  // releases the blocks that hold no element
+  void shrink_to_fit() noexcept {
+    const size_type first = head_ >> shift;
+    const size_type last = size_ ? ((head_ + size_ - 1) >> shift) + 1 : first;
+    for (size_type b = 0; b < map_cap_; ++b) {
+      if (map_[b] != nullptr && (b < first || b >= last)) {
+        a_traits::deallocate(alloc_, map_[b], block_size);
+        map_[b] = nullptr;
+      }
+    }
+  }
+
+  /* Modifiers */
+  void clear() noexcept {
+    for (size_type i = 0; i < size_; ++i)
+      a_traits::destroy(alloc_, &slot(head_ + i));
+    size_ = 0;
+    head_ = (map_cap_ / 2) << shift;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    T *p = back_slot();
+    a_traits::construct(alloc_, p, std::forward<Args>(args)...);
+    ++size_;
+    return *p;
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    T *p = front_slot();
+    a_traits::construct(alloc_, p, std::forward<Args>(args)...);
+    --head_;
+    ++size_;
+    return *p;
+  }
+
+  void pop_back() {
+    if (empty()) throw std::out_of_range("deque: deque is empty");
+    a_traits::destroy(alloc_, &slot(head_ + size_ - 1));
+    --size_;
+  }
+
+  void pop_front() {
+    if (empty()) throw std::out_of_range("deque: deque is empty");
+    a_traits::destroy(alloc_, &slot(head_));
+    ++head_;
+    --size_;
+  }
+
+  void swap(deque &other) noexcept {
+    std::swap(alloc_, other.alloc_);
+    std::swap(map_alloc_, other.map_alloc_);
+    std::swap(map_, other.map_);
+    std::swap(map_cap_, other.map_cap_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    (emplace_front(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  T &slot(size_type pos) const noexcept {
+    return map_[pos >> shift][pos & mask];
+  }
+
+  // uninitialized slot behind the last element
+  T *back_slot() {
+    if (size_ >= max_size()) throw std::length_error("deque: deque is too big");
+    if (((head_ + size_) >> shift) >= map_cap_) grow_map(true);
+    return block(head_ + size_) + ((head_ + size_) & mask);
+  }
+
+  // uninitialized slot in front of the first element
+  T *front_slot() {
+    if (size_ >= max_size()) throw std::length_error("deque: deque is too big");
+    if (head_ == 0) grow_map(false);
+    return block(head_ - 1) + ((head_ - 1) & mask);
+  }
+
+  T *block(size_type pos) {
+    T *&b = map_[pos >> shift];
+    if (b == nullptr) b = a_traits::allocate(alloc_, block_size);
+    return b;
+  }
+
+  // Makes room for one more block at the back or the front. The used blocks
+  // are centred in a map at least twice their number; spare blocks follow
+  // them so that they are reused before anything new is allocated. A map
+  // that is big enough is only rotated in place, so a FIFO drifting through
+  // it never reallocates the map.
+  void grow_map(bool at_back) {
+    const size_type first = head_ >> shift;
+    const size_type used =
+        size_ ? ((head_ + size_ - 1) >> shift) - first + 1 : 0;
+    size_type new_cap = map_cap_ < 8 ? 8 : map_cap_;
+    if ((used + 1) * 2 > new_cap) new_cap *= 2;
+    const size_type new_first = (new_cap - used) / 2 + (at_back ? 0 : 1);
+    if (new_cap == map_cap_) {
+      // used blocks to the front, spare ones right behind them, then the
+      // whole ring turned so that the used blocks start at new_first
+      std::rotate(map_, map_ + first, map_ + map_cap_);
+      std::partition(map_ + used, map_ + map_cap_,
+                     [](const T *b) { return b != nullptr; });
+      std::rotate(map_, map_ + map_cap_ - new_first, map_ + map_cap_);
+      head_ = (new_first << shift) + (head_ & mask);
+      return;
+    }
+    T **fresh = m_traits::allocate(map_alloc_, new_cap);
+    std::fill(fresh, fresh + new_cap, nullptr);
+    std::copy(map_ + first, map_ + first + used, fresh + new_first);
+    size_type spare = new_first + used;
+    for (size_type b = 0; b < map_cap_; ++b) {
+      if (map_[b] == nullptr || (b >= first && b < first + used)) continue;
+      while (fresh[spare % new_cap] != nullptr) ++spare;
+      fresh[spare % new_cap] = map_[b];
+    }
+    if (map_ != nullptr) m_traits::deallocate(map_alloc_, map_, map_cap_);
+    map_ = fresh;
+    map_cap_ = new_cap;
+    head_ = (new_first << shift) + (head_ & mask);
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_DEQUE_H
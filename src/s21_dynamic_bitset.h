@@ -0,0 +1,288 @@
+#ifndef S21_DYNAMIC_BITSET_H
+#define S21_DYNAMIC_BITSET_H
+#pragma once
+#include <cstdint>
+#include <stdexcept>
+
+#include "s21_allocators.h"
+#include "s21_simd.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+/*
+ * Resizable bit array packed into 64-bit words, one bit per flag instead of
+ * the byte s21::vector<bool> spends. Bits past size() in the last word are
+ * always zero, so whole words can be counted and combined without masking.
+ * count() and the &=, |=, ^=, and_not() operators run the s21::simd word
+ * kernels (AVX2 when the CPU has it); set/reset/flip over a range touch
+ * whole words between the two partial ends.
+ */
+class dynamic_bitset {
+ public:
+  using word_type = std::uint64_t;
+  using size_type = std::size_t;
+
+  static constexpr size_type bits_per_word = 64;
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // Proxy standing for one bit.
+  class reference {
+   public:
+    reference(word_type &word, word_type mask) noexcept
+        : word_(word), mask_(mask) {}
+    reference(const reference &) = default;
+
+    reference &operator=(bool value) noexcept {
+      if (value)
+        word_ |= mask_;
+      else
+        word_ &= ~mask_;
+      return *this;
+    }
+    reference &operator=(const reference &other) noexcept {
+      return *this = static_cast<bool>(other);
+    }
+    operator bool() const noexcept { return (word_ & mask_) != 0; }
+    bool operator~() const noexcept { return !*this; }
+    reference &flip() noexcept {
+      word_ ^= mask_;
+      return *this;
+    }
+
+   private:
+    word_type &word_;
+    word_type mask_;
+  };
+
+ private:
+  // 32-byte aligned words for the AVX2 kernels
+  vector<word_type, aligned_allocator<word_type, 32>> words_;
+  size_type size_ = 0;
+
+ public:
+  /* Member functions */
+  dynamic_bitset() = default;
+
+  explicit dynamic_bitset(size_type n, bool value = false) {
+    resize(n, value);
+  }
+
+  dynamic_bitset(std::initializer_list<bool> const &items) {
+    reserve(items.size());
+    for (bool item : items) push_back(item);
+  }
+
+  /* Element access */
+  bool operator[](size_type pos) const noexcept {
+    return (words_[word_index(pos)] & bit_mask(pos)) != 0;
+  }
+  reference operator[](size_type pos) noexcept {
+    return reference(words_[word_index(pos)], bit_mask(pos));
+  }
+
+  bool test(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("dynamic_bitset: out of range");
+    return (*this)[pos];
+  }
+
+  // number of set bits
+  size_type count() const noexcept {
+    return simd::detail::popcount(words_.data(), words_.size());
+  }
+  bool all() const noexcept { return count() == size_; }
+  bool any() const noexcept { return find_first() != npos; }
+  bool none() const noexcept { return !any(); }
+
+  // position of the first set bit, npos if there is none
+  size_type find_first() const noexcept { return find_from(0); }
+
+  // position of the first set bit after pos, npos if there is none
+  size_type find_next(size_type pos) const noexcept {
+    return pos + 1 >= size_ ? npos : find_from(pos + 1);
+  }
+
+  // the packed words, bit i is bit i % 64 of word i / 64
+  const word_type *data() const noexcept { return words_.data(); }
+  size_type num_words() const noexcept { return words_.size(); }
+
+  /* Capacity */
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept {
+    return words_.capacity() * bits_per_word;
+  }
+  void reserve(size_type n) { words_.reserve(words_for(n)); }
+
+  /* Modifiers */
+  dynamic_bitset &set(size_type pos, bool value = true) {
+    if (pos >= size_) throw std::out_of_range("dynamic_bitset: out of range");
+    (*this)[pos] = value;
+    return *this;
+  }
+  dynamic_bitset &reset(size_type pos) { return set(pos, false); }
+  dynamic_bitset &flip(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("dynamic_bitset: out of range");
+    words_[word_index(pos)] ^= bit_mask(pos);
+    return *this;
+  }
+
+  // sets, resets or flips the len bits starting at pos
+  dynamic_bitset &set(size_type pos, size_type len, bool value) {
+    if (value)
+      apply_range(pos, len, [](word_type &w, word_type m) { w |= m; });
+    else
+      apply_range(pos, len, [](word_type &w, word_type m) { w &= ~m; });
+    return *this;
+  }
+  dynamic_bitset &reset(size_type pos, size_type len) {
+    return set(pos, len, false);
+  }
+  dynamic_bitset &flip(size_type pos, size_type len) {
+    apply_range(pos, len, [](word_type &w, word_type m) { w ^= m; });
+    return *this;
+  }
+
+  // whole bitset
+  dynamic_bitset &set() { return set(0, size_, true); }
+  dynamic_bitset &reset() { return set(0, size_, false); }
+  dynamic_bitset &flip() { return flip(0, size_); }
+
+  void push_back(bool value) {
+    if (size_ % bits_per_word == 0) words_.push_back(0);
+    ++size_;
+    (*this)[size_ - 1] = value;
+  }
+
+  void pop_back() {
+    if (empty()) throw std::out_of_range("dynamic_bitset: bitset is empty");
+    resize(size_ - 1);
+  }
+
+  void resize(size_type n, bool value = false) {
+    const size_type old_size = size_;
+    words_.resize(words_for(n), 0);
+    size_ = n;
+    if (n > old_size) {
+      set(old_size, n - old_size, value);
+    } else {
+      clear_padding();
+    }
+  }
+
+  void clear() noexcept {
+    words_.clear();
+    size_ = 0;
+  }
+
+  void swap(dynamic_bitset &other) noexcept {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  /* Bitwise operations, both operands must have the same size */
+  dynamic_bitset &operator&=(const dynamic_bitset &other) {
+    return combine<simd::detail::word_op::and_>(other);
+  }
+  dynamic_bitset &operator|=(const dynamic_bitset &other) {
+    return combine<simd::detail::word_op::or_>(other);
+  }
+  dynamic_bitset &operator^=(const dynamic_bitset &other) {
+    return combine<simd::detail::word_op::xor_>(other);
+  }
+  // clears the bits set in other: *this &= ~other
+  dynamic_bitset &and_not(const dynamic_bitset &other) {
+    return combine<simd::detail::word_op::and_not>(other);
+  }
+
+  dynamic_bitset operator~() const {
+    dynamic_bitset result(*this);
+    return result.flip();
+  }
+
+  bool operator==(const dynamic_bitset &other) const noexcept {
+    if (size_ != other.size_) return false;
+    for (size_type i = 0; i < words_.size(); ++i)
+      if (words_[i] != other.words_[i]) return false;
+    return true;
+  }
+  bool operator!=(const dynamic_bitset &other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  static size_type word_index(size_type pos) noexcept {
+    return pos / bits_per_word;
+  }
+  static word_type bit_mask(size_type pos) noexcept {
+    return word_type{1} << (pos % bits_per_word);
+  }
+  static size_type words_for(size_type bits) noexcept {
+    return (bits + bits_per_word - 1) / bits_per_word;
+  }
+
+  // keeps the bits past size_ zero
+  void clear_padding() noexcept {
+    if (size_ % bits_per_word)
+      words_[words_.size() - 1] &= bit_mask(size_) - 1;
+  }
+
+  // op(word, mask) on every word overlapping [pos, pos + len)
+  template <typename Op>
+  void apply_range(size_type pos, size_type len, Op op) {
+    if (pos > size_ || len > size_ - pos)
+      throw std::out_of_range("dynamic_bitset: range out of range");
+    if (len == 0) return;
+    const size_type last = pos + len - 1;
+    const size_type first_word = word_index(pos);
+    const size_type last_word = word_index(last);
+    const word_type head = ~word_type{0} << (pos % bits_per_word);
+    const word_type tail = ~word_type{0} >> (bits_per_word - 1 -
+                                             last % bits_per_word);
+    if (first_word == last_word) {
+      op(words_[first_word], head & tail);
+      return;
+    }
+    op(words_[first_word], head);
+    for (size_type w = first_word + 1; w < last_word; ++w)
+      op(words_[w], ~word_type{0});
+    op(words_[last_word], tail);
+  }
+
+  size_type find_from(size_type pos) const noexcept {
+    size_type w = word_index(pos);
+    if (w >= words_.size()) return npos;
+    word_type bits = words_[w] & (~word_type{0} << (pos % bits_per_word));
+    while (bits == 0) {
+      if (++w == words_.size()) return npos;
+      bits = words_[w];
+    }
+    return w * bits_per_word + __builtin_ctzll(bits);
+  }
+
+  template <simd::detail::word_op Op>
+  dynamic_bitset &combine(const dynamic_bitset &other) {
+    if (size_ != other.size_)
+      throw std::invalid_argument("dynamic_bitset: sizes differ");
+    simd::detail::combine<Op>(words_.data(), other.words_.data(),
+                              words_.size());
+    return *this;
+  }
+};
+
+inline dynamic_bitset operator&(dynamic_bitset a, const dynamic_bitset &b) {
+  a &= b;
+  return a;
+}
+inline dynamic_bitset operator|(dynamic_bitset a, const dynamic_bitset &b) {
+  a |= b;
+  return a;
+}
+inline dynamic_bitset operator^(dynamic_bitset a, const dynamic_bitset &b) {
+  a ^= b;
+  return a;
+}
+
+}  // namespace s21
+
+#endif  // S21_DYNAMIC_BITSET_H
@@ -0,0 +1,257 @@
+#ifndef S21_INTRUSIVE_LIST_H
+#define S21_INTRUSIVE_LIST_H
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+
+#include "s21_list.h"
+
+namespace s21 {
+
+namespace intrusive_detail {
+
+// Byte offset of the Hook member inside T, taken from uninitialized storage
+// so that T needs no default constructor.
+template <typename T, listNode_base T::*Hook>
+std::ptrdiff_t hook_offset() noexcept {
+  alignas(T) static unsigned char storage[sizeof(T)];
+  const T *object = reinterpret_cast<const T *>(storage);
+  return reinterpret_cast<const unsigned char *>(&(object->*Hook)) - storage;
+}
+
+template <typename T, listNode_base T::*Hook>
+T *owner(listNode_base *node) noexcept {
+  return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(node) -
+                               hook_offset<T, Hook>());
+}
+
+}  // namespace intrusive_detail
+
+template <typename T, listNode_base T::*Hook, bool is_const = false>
+class IntrusiveIterator_base {
+ public:
+  using pointer = std::conditional_t<is_const, const T *, T *>;
+  using reference = std::conditional_t<is_const, const T &, T &>;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+ private:
+  listNode_base *node_;
+
+ public:
+  explicit IntrusiveIterator_base(listNode_base *node) noexcept
+      : node_(node) {}
+  // iterator -> const_iterator conversion
+  template <bool c = is_const, typename = std::enable_if_t<c>>
+  IntrusiveIterator_base(
+      const IntrusiveIterator_base<T, Hook, false> &other) noexcept
+      : node_(other.node()) {}
+
+  reference operator*() const noexcept {
+    return *intrusive_detail::owner<T, Hook>(node_);
+  }
+  pointer operator->() const noexcept {
+    return intrusive_detail::owner<T, Hook>(node_);
+  }
+
+  IntrusiveIterator_base &operator++() noexcept {
+    node_ = node_->getNext();
+    return *this;
+  }
+  IntrusiveIterator_base operator++(int) noexcept {
+    IntrusiveIterator_base tmp = *this;
+    ++*this;
+    return tmp;
+  }
+  IntrusiveIterator_base &operator--() noexcept {
+    node_ = node_->getPrev();
+    return *this;
+  }
+  IntrusiveIterator_base operator--(int) noexcept {
+    IntrusiveIterator_base tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  bool operator==(const IntrusiveIterator_base &other) const noexcept {
+    return node_ == other.node_;
+  }
+  bool operator!=(const IntrusiveIterator_base &other) const noexcept {
+    return !(*this == other);
+  }
+
+  listNode_base *node() const noexcept { return node_; }
+};
+
+/*
+ * List of objects that carry their own links: T embeds a listNode_base
+ * member named by Hook, and an object with several hooks can sit in as many
+ * lists at once. The list never allocates, copies or destroys elements; it
+ * only links and unlinks them, so every operation but size() and clear() is
+ * O(1) and an element can drop out of its list by itself with
+ * (obj.*Hook).unlink(), which is also why size() has to count. An element
+ * must stay alive, and stay put in memory, while it is linked. Builds
+ * without NDEBUG assert that pushed elements are not linked yet, that
+ * erased ones are, and that no hook is destroyed while linked, which
+ * catches an element freed or moved from without being unlinked first.
+ *
+ *   struct timer { listNode_base by_deadline, by_owner; ... };
+ *   intrusive_list<timer, &timer::by_deadline> wheel_slot;
+ */
+template <typename T, listNode_base T::*Hook>
+class intrusive_list {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = IntrusiveIterator_base<T, Hook, false>;
+  using const_iterator = IntrusiveIterator_base<T, Hook, true>;
+  using size_type = std::size_t;
+
+ private:
+  listNode_base fake_node;
+
+ public:
+  /* Member functions */
+  intrusive_list() = default;
+
+  // the elements belong to their owners, not to the list
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list &operator=(const intrusive_list &) = delete;
+
+  intrusive_list(intrusive_list &&other) noexcept { swap(other); }
+
+  intrusive_list &operator=(intrusive_list &&other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  // leaves every element unlinked
+  ~intrusive_list() { clear(); }
+
+  /* Element access */
+  reference front() {
+    if (empty()) throw std::out_of_range("intrusive_list: list is empty");
+    return *begin();
+  }
+  const_reference front() const {
+    if (empty()) throw std::out_of_range("intrusive_list: list is empty");
+    return *begin();
+  }
+  reference back() {
+    if (empty()) throw std::out_of_range("intrusive_list: list is empty");
+    return *--end();
+  }
+  const_reference back() const {
+    if (empty()) throw std::out_of_range("intrusive_list: list is empty");
+    return *--end();
+  }
+
+  /* Iterators */
+  iterator begin() noexcept { return iterator(fake_node.getNext()); }
+  iterator end() noexcept { return iterator(&fake_node); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cbegin() const noexcept {
+    return const_iterator(fake_node.getNext());
+  }
+  const_iterator cend() const noexcept {
+    return const_iterator(const_cast<listNode_base *>(&fake_node));
+  }
+
+  // iterator to a linked element, found through its hook in O(1)
+  iterator iterator_to(reference value) noexcept {
+    assert((value.*Hook).is_linked() && "intrusive_list: not linked");
+    return iterator(&(value.*Hook));
+  }
+  const_iterator iterator_to(const_reference value) const noexcept {
+    assert((value.*Hook).is_linked() && "intrusive_list: not linked");
+    return const_iterator(const_cast<listNode_base *>(&(value.*Hook)));
+  }
+
+  /* Capacity */
+  bool empty() const noexcept { return !fake_node.is_linked(); }
+  // O(n): elements may unlink themselves without telling the list
+  size_type size() const noexcept {
+    size_type n = 0;
+    for (const listNode_base *node = fake_node.getNext(); node != &fake_node;
+         node = node->getNext())
+      ++n;
+    return n;
+  }
+
+  /* Modifiers */
+  // unlinks every element
+  void clear() noexcept {
+    listNode_base *node = fake_node.getNext();
+    while (node != &fake_node) {
+      listNode_base *next = node->getNext();
+      listNode_base::link(node, node);
+      node = next;
+    }
+    listNode_base::link(&fake_node, &fake_node);
+  }
+
+  // links value before pos, returns the iterator to it
+  iterator insert(const_iterator pos, reference value) noexcept {
+    listNode_base &hook = value.*Hook;
+    assert(!hook.is_linked() && "intrusive_list: element already linked");
+    hook.rebase(pos.node());
+    return iterator(&hook);
+  }
+
+  // unlinks the element at pos, returns the iterator to the next one
+  iterator erase(const_iterator pos) noexcept {
+    assert(pos != cend() && pos.node()->is_linked() &&
+           "intrusive_list: erasing end() or an unlinked element");
+    listNode_base *next = pos.node()->getNext();
+    pos.node()->unlink();
+    return iterator(next);
+  }
+
+  // unlinks value from this list
+  void remove(reference value) noexcept { erase(iterator_to(value)); }
+
+  void push_back(reference value) noexcept { insert(cend(), value); }
+  void push_front(reference value) noexcept { insert(cbegin(), value); }
+  void pop_back() {
+    if (empty()) throw std::out_of_range("intrusive_list: list is empty");
+    erase(--cend());
+  }
+  void pop_front() {
+    if (empty()) throw std::out_of_range("intrusive_list: list is empty");
+    erase(cbegin());
+  }
+
+  // moves every element of other before pos in O(1)
+  void splice(const_iterator pos, intrusive_list &other) noexcept {
+    if (this == &other || other.empty()) return;
+    listNode_base *at = pos.node();
+    listNode_base *head = other.fake_node.getNext();
+    listNode_base *tail = other.fake_node.getPrev();
+    listNode_base::link(&other.fake_node, &other.fake_node);
+    listNode_base::link(at->getPrev(), head);
+    listNode_base::link(tail, at);
+  }
+
+  // moves the element at it, from other or this list, before pos in O(1)
+  void splice(const_iterator pos, intrusive_list &,
+              const_iterator it) noexcept {
+    if (pos == it || pos.node() == it.node()->getNext()) return;
+    it.node()->rebase(pos.node());
+  }
+
+  void swap(intrusive_list &other) noexcept {
+    fake_node.swap(other.fake_node);
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_INTRUSIVE_LIST_H
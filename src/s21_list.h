@@ -1,6 +1,8 @@
 #ifndef _S21_LIST_H
 #define _S21_LIST_H 1
 #pragma once
+#include <cassert>
+
 #include "s21_containers_common.h"
 
 namespace s21 {
@@ -11,15 +13,23 @@ struct listNode_base {
 
  public:
   listNode_base() : next(myBase()), prev(myBase()) {}
+  // a copy is not linked anywhere: the links belong to the original's place
+  listNode_base(const listNode_base &) noexcept : listNode_base() {}
+  listNode_base &operator=(const listNode_base &) noexcept { return *this; }
+  // a node destroyed while linked would leave its neighbours dangling
+  ~listNode_base() {
+    assert(!is_linked() && "listNode_base: destroyed while linked");
+  }
 
   void swapNeighbors() noexcept { std::swap(next, prev); }
 
+  // swaps the chains hooked to two nodes, either of which may be alone
   void swap(listNode_base &other) noexcept {
-    std::swap(*this, other);
-    next->prev = this;
-    prev->next = this;
-    other.next->prev = &other;
-    other.prev->next = &other;
+    const bool alone = next == this, other_alone = other.next == &other;
+    std::swap(next, other.next);
+    std::swap(prev, other.prev);
+    relink(other_alone);
+    other.relink(alone);
   }
   // перенос ноды перед pos можно в другой лист
   void rebase(listNode_base *pos) noexcept {
@@ -31,8 +41,33 @@ struct listNode_base {
 
   listNode_base *getPrev() const noexcept { return this->prev; }
 
+  // true while the node sits in a list (or, for a sentinel, the list is not
+  // empty)
+  bool is_linked() const noexcept { return next != this; }
+
+  // takes the node out of its list in O(1) and leaves it alone
+  void unlink() noexcept {
+    unhook();
+    next = prev = myBase();
+  }
+
+  // a <-> b, for algorithms that relink whole chains of nodes at once
+  static void link(listNode_base *a, listNode_base *b) noexcept {
+    a->next = b;
+    b->prev = a;
+  }
+
  protected:
   listNode_base *myBase() noexcept { return this; }
+  // points the neighbours back at the node after its links were replaced
+  void relink(bool alone) noexcept {
+    if (alone) {
+      next = prev = this;
+    } else {
+      next->prev = this;
+      prev->next = this;
+    }
+  }
   // Hooks the node into the list before the node pointed to by parent.
   // \param[in] pos The node before which the node is inserted.
   // \pre parent != nullptr
@@ -67,8 +102,14 @@ class listNode : public listNode_base {
   }
   /*Специальный конструктор сразу со вставкой*/
   listNode(const T &d, listNode_base *pos) : data_(d) { hook(pos); }
+  // builds the value in place from args and hooks the node before pos
+  template <typename... Args>
+  explicit listNode(listNode_base *pos, Args &&...args)
+      : data_(std::forward<Args>(args)...) {
+    hook(pos);
+  }
 
-  ~listNode() { unhook(); }
+  ~listNode() { unlink(); }
 
   T *pointer() { return &data_; }
   const T *pointer() const { return &data_; }
@@ -97,6 +138,10 @@ class ListIterator_base {
   ListIterator_base(node_base *node) : node(node) {}
   ListIterator_base(const node_base *node)
       : node(const_cast<node_base *>(node)) {}
+  // iterator -> const_iterator conversion
+  template <bool c = is_const, typename = std::enable_if_t<c>>
+  ListIterator_base(const ListIterator_base<T, false> &other) noexcept
+      : node(other.get_node()) {}
   reference operator*() noexcept { return get_node()->data(); }
   pointer operator->() noexcept { return get_node()->pointer(); }
   node_type *get_node() const { return static_cast<node_type *>(node); }
@@ -140,8 +185,11 @@ using ListConstIterator = ListIterator_base<T, true>;
 
 template <typename T, typename Allocator = std::allocator<listNode<T>>>
 class list {
-  using a_traits = std::allocator_traits<Allocator>;
   using node_type = listNode<T>;
+  // any allocator is rebound to the node type, so list<T, my_alloc<T>> works
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<node_type>;
+  using a_traits = std::allocator_traits<node_allocator>;
 
  public:
   using value_type = T;
@@ -150,11 +198,12 @@ class list {
   using iterator = ListIterator<T>;
   using const_iterator = ListConstIterator<T>;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
  private:
   listNode_base fake_node;
   size_type size_;
-  Allocator alloc;
+  node_allocator alloc;
 
  public:
   // *List Functions*
@@ -162,7 +211,10 @@ class list {
   list()
       : fake_node(),
         size_(0),
-        alloc(a_traits::select_on_container_copy_construction(Allocator())) {};
+        alloc(a_traits::select_on_container_copy_construction(
+            node_allocator())) {};
+  // creates empty list that allocates its nodes through a copy of a
+  explicit list(const Allocator &a) : fake_node(), size_(0), alloc(a) {}
 
   // parameterized constructor, creates the list of size n
   list(size_type n) : list() {
@@ -177,14 +229,16 @@ class list {
 
   // initializer list constructor, creates list
   // initizialized using std::initializer_list<T>
-  list(std::initializer_list<value_type> const &items) : list() {
+  list(std::initializer_list<value_type> const &items,
+       const Allocator &a = Allocator())
+      : list(a) {
     for (auto it = items.begin(); it != items.end(); it++) push_back(*it);
   };
 
   // copy constructor
   list(const list &l) : list() { *this = l; };
-  // move constructor
-  list(list &&l) : list() { *this = l; };
+  // move constructor, takes over the nodes of l
+  list(list &&l) noexcept : list() { swap(l); };
   // destructor
   ~list() { clear(); };
   // assignment operator overload for copying object
@@ -209,21 +263,29 @@ class list {
     return *this;
   };
   // assignment operator overload for moving object
-  list &operator=(list &&l) {
+  list &operator=(list &&l) noexcept {
     swap(l);
     return *this;
   };
   // *List Element access*
   // access the first element
-  const_reference front() {
+  reference front() {
     if (empty()) throw std::out_of_range("list: list is empty");
     return *(begin());
   };
+  const_reference front() const {
+    if (empty()) throw std::out_of_range("list: list is empty");
+    return *(cbegin());
+  };
   // access the last element
-  const_reference back() {
+  reference back() {
     if (empty()) throw std::out_of_range("list: list is empty");
     return *(--end());
   };
+  const_reference back() const {
+    if (empty()) throw std::out_of_range("list: list is empty");
+    return *(--cend());
+  };
 
   // *List Iterators*
   // returns an iterator to the beginning
@@ -249,6 +311,8 @@ class list {
   size_type max_size() const noexcept {
     return static_cast<size_type>((-1) / sizeof(node_type));
   };
+  // returns the allocator (a copy of the one the nodes come from)
+  Allocator get_allocator() const { return Allocator(alloc); }
 
   // *List Modifiers*
   // clears the contents
@@ -258,11 +322,25 @@ class list {
   // inserts element into concrete pos and returns
   // the iterator that points to the new element
   iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  };
+  iterator insert(iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+  // constructs an element from args in place before pos
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
     node_type *new_node = a_traits::allocate(alloc, 1);
-    a_traits::construct(alloc, new_node, value, pos.get_node());
+    try {
+      a_traits::construct(alloc, new_node, pos.constcast().get_node(),
+                          std::forward<Args>(args)...);
+    } catch (...) {
+      a_traits::deallocate(alloc, new_node, 1);
+      throw;
+    }
     size_++;
     return iterator(new_node);
-  };
+  }
   // erases element at pos
   void erase(iterator pos) noexcept {
     if (pos == end() || empty()) return;
@@ -272,6 +350,11 @@ class list {
   }
   // adds an element to the end
   void push_back(const_reference value) { insert(end(), value); }
+  void push_back(value_type &&value) { insert(end(), std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplace(cend(), std::forward<Args>(args)...);
+  }
   // removes the last element
   void pop_back() noexcept {
     if (empty()) return;
@@ -279,6 +362,11 @@ class list {
   }
   // adds an element to the head
   void push_front(const_reference value) { insert(begin(), value); }
+  void push_front(value_type &&value) { insert(begin(), std::move(value)); }
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    return *emplace(cbegin(), std::forward<Args>(args)...);
+  }
   // removes the first element
   void pop_front() noexcept { erase(begin()); }
   // swaps the contents
@@ -286,31 +374,56 @@ class list {
     // меняем местами фейковую ноду, вчсе остальные ноды потянутся за ней.
     fake_node.swap(other.fake_node);
     std::swap(size_, other.size_);
+    std::swap(alloc, other.alloc);
   };
   // merges two sorted lists
-  void merge(list &other) {
+  void merge(list &other) { merge(other, std::less<>()); }
+  // merges two lists sorted by comp; equal elements of *this come first
+  template <typename Compare>
+  void merge(list &other, Compare comp) {
     if (&fake_node == &other.fake_node) return;
     if (other.empty()) return;
     if (empty()) swap(other);
     for (iterator it = begin(); !other.empty(); ++it) {
-      while (!(other.empty()) && (it == end() || *(other.begin()) < *it)) {
+      while (!(other.empty()) &&
+             (it == end() || comp(*(other.begin()), *it))) {
         other.begin().get_node()->rebase(it.get_node());
         ++size_;
         --other.size_;
       }
     }
   }
-  // transfers elements from list
-  // other starting from pos
-  void splice(const_iterator pos, list &other) {
-    if (&fake_node == &other.fake_node) return;
-    if (other.empty()) return;
-    while (!other.empty()) {
-      other.begin().get_node()->rebase(pos.constcast().get_node());
+  // transfers all elements of other before pos in O(1)
+  void splice(const_iterator pos, list &other) noexcept {
+    if (&fake_node == &other.fake_node || other.empty()) return;
+    transfer(pos, other.cbegin(), other.cend());
+    size_ += other.size_;
+    other.size_ = 0;
+  }
+  // transfers the element at it from other (or this list) before pos
+  void splice(const_iterator pos, list &other, const_iterator it) noexcept {
+    const_iterator next = it;
+    ++next;
+    if (pos == it || pos == next) return;
+    transfer(pos, it, next);
+    if (&fake_node != &other.fake_node) {
       ++size_;
       --other.size_;
     }
   }
+  // transfers [first, last) from other before pos; O(1) within one list,
+  // linear in the length of the range between two lists for the sizes
+  void splice(const_iterator pos, list &other, const_iterator first,
+              const_iterator last) noexcept {
+    if (first == last || pos == last) return;
+    if (&fake_node != &other.fake_node) {
+      size_type n = 0;
+      for (const_iterator it = first; it != last; ++it) ++n;
+      size_ += n;
+      other.size_ -= n;
+    }
+    transfer(pos, first, last);
+  }
   // reverses the order of the elements
   void reverse() noexcept {
     // меняем ссылки на предыдущий и следующий элемент местами. Переходим к
@@ -330,22 +443,45 @@ class list {
       while (*it == *nextit) erase(nextit++);
     }
   }  //
-  void sort() {
+  // sorts the elements
+  void sort() { sort(std::less<>()); }
+  // Stable bottom-up merge sort that relinks the nodes, so elements are
+  // never copied or moved and iterators stay valid. Nodes are taken one by
+  // one into bins of 1, 2, 4, ... nodes like the digits of a binary counter,
+  // merging short runs while they are still in cache. O(n log n) time, no
+  // recursion, no allocation.
+  template <typename Compare>
+  void sort(Compare comp) {
     if (size_ < 2) return;
-    quick_sort_recursive(begin(), --end());
+    run bins[std::numeric_limits<size_type>::digits];
+    std::size_t used = 0;
+    listNode_base *node = fake_node.getNext();
+    while (node != &fake_node) {
+      run carry{node, node, 1};
+      node = node->getNext();
+      std::size_t k = 0;
+      for (; k < used && bins[k].size != 0; ++k) {
+        carry = merge_runs(bins[k], carry, comp);
+        bins[k].size = 0;
+      }
+      bins[k] = carry;
+      if (k == used) ++used;
+    }
+    run result{nullptr, nullptr, 0};
+    for (std::size_t k = 0; k < used; ++k) {
+      if (bins[k].size == 0) continue;
+      result = result.size ? merge_runs(bins[k], result, comp) : bins[k];
+    }
+    listNode_base::link(&fake_node, result.head);
+    listNode_base::link(result.tail, &fake_node);
   }
 
-  // sorts the elements
   // extra functions
-  // Inserts new elements into the container directly before `pos`
+  // Inserts new elements into the container directly before `pos`, each
+  // constructed from one of args
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args) {
-    for (auto arg : {std::forward<Args>(args)...}) {
-      a_traits::construct(alloc, a_traits::allocate(alloc, 1),
-                          std::forward<decltype(arg)>(arg),
-                          pos.constcast().get_node());
-      ++size_;
-    }
+    (emplace(pos, std::forward<Args>(args)), ...);
     return iterator(--pos.constcast());
   }
   // Appends new elements to the end of the container.
@@ -363,45 +499,45 @@ class list {
   }
 
  private:
-  /**
-   * Делит сегмент списка на две части вокруг опорного элемента:
-   * Элементы меньше или равные опорному элементу перемещаются влево
-   * а элементы больше опорного перемещаются вправо.
-   *
-   * @param low Итератор указывающий на первый элемент сегмента списка
-   * @param high Итератор указывающий на конец сегмента списка. Он же
-   * используется как опорный.
-   * @return Итератор, указывающий на опорный элемент.
-   */
-  iterator partition(iterator low, iterator high) {
-    auto pivot = *high;
-    auto i = low;
-    for (auto j = low; j != high; ++j) {
-      if (*j <= pivot) {
-        std::swap(*i, *j);
-        ++i;
-      }
-    }
-    std::swap(*i, *high);
-    return i;
-  }
-
-  /**
-   * @brief Рекурсивно сортирует кусок листа по qsort-алгоритму.
-   *
-   * @param low Итератор на первый элемент.
-   * @param high Итератор на последний элемент.
-   *
-   * @details
-   * Функция делит список на части и сортирует каждую часть отдельно, потом
-   * между собой.
-   */
-  void quick_sort_recursive(iterator low, iterator high) {
-    if (low != high && low != ++high) {
-      auto pivot = partition(low, --high);
-      quick_sort_recursive(low, --pivot);
-      quick_sort_recursive(++pivot, high);
+  // relinks the nodes [first, last) in front of pos, which is outside them
+  static void transfer(const_iterator pos, const_iterator first,
+                       const_iterator last) noexcept {
+    listNode_base *const at = pos.constcast().get_node();
+    listNode_base *const head = first.constcast().get_node();
+    listNode_base *const tail = last.constcast().get_node()->getPrev();
+    listNode_base::link(head->getPrev(), last.constcast().get_node());
+    listNode_base::link(at->getPrev(), head);
+    listNode_base::link(tail, at);
+  }
+
+  // size linked nodes from head to tail; tail->next is not part of the run
+  struct run {
+    listNode_base *head, *tail;
+    size_type size;
+  };
+
+  static const_reference value(const listNode_base *node) noexcept {
+    return static_cast<const node_type *>(node)->data();
+  }
+
+  // merges two runs, a holding the earlier elements, into one
+  template <typename Compare>
+  static run merge_runs(run a, run b, Compare &comp) {
+    listNode_base head;
+    listNode_base *tail = &head;
+    const size_type size = a.size + b.size;
+    while (a.size != 0 && b.size != 0) {
+      run &from = comp(value(b.head), value(a.head)) ? b : a;
+      listNode_base::link(tail, from.head);
+      tail = from.head;
+      from.head = from.head->getNext();
+      --from.size;
     }
+    const run &rest = a.size != 0 ? a : b;
+    listNode_base::link(tail, rest.head);
+    listNode_base *first = head.getNext();
+    listNode_base::link(&head, &head);
+    return run{first, rest.tail, size};
   }
 };
 }  // namespace s21
@@ -5,47 +5,55 @@
 
 namespace s21 {
 
-template <typename Key, typename T>
-class map : public BinaryTree<std::pair<const Key, T>> {
+template <typename Key, typename T,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class map : public BinaryTree<std::pair<const Key, T>, Allocator> {
+  using tree_type = BinaryTree<std::pair<const Key, T>, Allocator>;
+
  public:
   using key_type = Key;
   using mapped_type = T;
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename BinaryTree<value_type>::iterator;
-  using const_iterator = typename BinaryTree<value_type>::const_iterator;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using size_type = size_t;
 
   /* Member functions */
   // default constructor
   map() {}
 
+  // creates empty map that allocates through a copy of alloc
+  explicit map(const Allocator &alloc) : tree_type(alloc) {}
+
   // initializer list constructor
-  map(std::initializer_list<value_type> const &items) {
+  map(std::initializer_list<value_type> const &items,
+      const Allocator &alloc = Allocator())
+      : tree_type(alloc) {
     for (const auto &item : items) {
       insert(item.first, item.second);
     }
   }
 
   // copy constructor
-  map(const map &m) : BinaryTree<value_type>(m) {}
+  map(const map &m) : tree_type(m) {}
 
   // move constructor
-  map(map &&m) noexcept : BinaryTree<value_type>(std::move(m)) {}
+  map(map &&m) noexcept : tree_type(std::move(m)) {}
 
   // destructor
   ~map() noexcept {}
 
   // move assignment operator
   map &operator=(map &&m) {
-    BinaryTree<value_type>::operator=(std::move(m));
+    tree_type::operator=(std::move(m));
     return *this;
   }
 
   /* Element access */
   T &at(const Key &key) {
-    auto it = BinaryTree<value_type>::find(key);
+    auto it = tree_type::find(key);
     if (it == end()) throw std::out_of_range("Key not found");
     return it->second;
   }
@@ -56,24 +64,24 @@ class map : public BinaryTree<std::pair<const Key, T>> {
   }
 
   /* Iterators */
-  using BinaryTree<value_type>::begin;
-  using BinaryTree<value_type>::end;
+  using tree_type::begin;
+  using tree_type::end;
 
   /* Capacity */
-  using BinaryTree<value_type>::empty;
-  using BinaryTree<value_type>::size;
-  using BinaryTree<value_type>::max_size;
+  using tree_type::empty;
+  using tree_type::size;
+  using tree_type::max_size;
 
   /* Modifiers */
-  using BinaryTree<value_type>::clear;
-  using BinaryTree<value_type>::insert;
+  using tree_type::clear;
+  using tree_type::insert;
 
   std::pair<iterator, bool> insert(const Key &key, const T &obj) {
-    return BinaryTree<value_type>::insert(std::make_pair(key, obj));
+    return tree_type::insert(std::make_pair(key, obj));
   }
 
   std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
-    auto result = BinaryTree<value_type>::insert(std::make_pair(key, obj));
+    auto result = tree_type::insert(std::make_pair(key, obj));
     if (!result.second)
       result.first->second = obj;  // update the value of the existing key
     return result;
@@ -95,14 +103,14 @@ insertion takes O(log n) time. Each insertion is atomic.*/
     return results;
   }
 
-  using BinaryTree<value_type>::erase;
+  using tree_type::erase;
 
   void swap(map &other) noexcept { std::swap(*this, other); }
 
-  void merge(map &other) { BinaryTree<value_type>::merge(other); }
+  void merge(map &other) { tree_type::merge(other); }
 
   /* Lookup */
-  using BinaryTree<value_type>::contains;
+  using tree_type::contains;
 };
 
 // deduction guide
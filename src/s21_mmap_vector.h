@@ -0,0 +1,353 @@
+#ifndef S21_MMAP_VECTOR_H
+#define S21_MMAP_VECTOR_H
+#pragma once
+#include <cerrno>
+#include <string>
+#include <system_error>
+
+#include "s21_allocators.h"
+#include "s21_vector.h"
+
+#ifdef __unix__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace s21 {
+
+enum class mmap_mode {
+  read_only,   // zero-copy copy-on-write view of a file, cannot grow
+  read_write,  // existing file, grows with ftruncate() and remapping
+  create       // like read_write, the file is created or truncated
+};
+
+enum class access_hint { normal, sequential, random, will_need, dont_need };
+
+/*
+ * Vector of trivially copyable elements stored in a file and accessed
+ * through a shared mapping, so opening costs no copy and pages are read on
+ * first touch. A writable vector keeps the file at capacity() elements and
+ * truncates it to size() on close(); sync() flushes dirty pages with msync()
+ * and advise() forwards access patterns to madvise(). A read-only vector
+ * maps the file privately: its elements can still be modified, which copies
+ * the touched pages, but the changes never reach the file.
+ * Iterators and references are invalidated by growth, like s21::vector's.
+ */
+template <typename T>
+class mmap_vector : public s21_sequence_container {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mmap_vector: elements are stored as raw bytes");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = VectorIterator<T>;
+  using const_iterator = VectorConstIterator<T>;
+
+ private:
+  T *data_ = nullptr;
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+  int fd_ = -1;
+  bool writable_ = false;
+
+ public:
+  /* Member functions */
+  mmap_vector() noexcept = default;
+
+  explicit mmap_vector(const std::string &path,
+                       mmap_mode mode = mmap_mode::read_only) {
+    open(path, mode);
+  }
+
+  mmap_vector(const mmap_vector &) = delete;
+  mmap_vector &operator=(const mmap_vector &) = delete;
+
+  mmap_vector(mmap_vector &&other) noexcept { swap(other); }
+
+  mmap_vector &operator=(mmap_vector &&other) noexcept {
+    if (this != &other) {
+      close_noexcept();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~mmap_vector() { close_noexcept(); }
+
+  void open(const std::string &path, mmap_mode mode = mmap_mode::read_only) {
+    close();
+    int flags = mode == mmap_mode::read_only ? O_RDONLY : O_RDWR;
+    if (mode == mmap_mode::create) flags |= O_CREAT | O_TRUNC;
+    const int fd = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+    if (fd < 0) throw error("open " + path);
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+      const int err = errno;
+      ::close(fd);
+      errno = err;
+      throw error("stat " + path);
+    }
+    const size_type bytes = static_cast<size_type>(st.st_size);
+    if (bytes % sizeof(T) != 0) {
+      ::close(fd);
+      throw std::runtime_error("mmap_vector: " + path +
+                               " does not hold whole elements");
+    }
+    fd_ = fd;
+    writable_ = mode != mmap_mode::read_only;
+    try {
+      map(bytes / sizeof(T));
+    } catch (...) {
+      release();
+      throw;
+    }
+    size_ = capacity_;
+  }
+
+  // unmaps and closes the file, cutting a writable file down to size()
+  void close() {
+    if (fd_ < 0) return;
+    const bool truncate = writable_;
+    const off_t bytes = static_cast<off_t>(size_ * sizeof(T));
+    unmap();
+    const int rc = truncate ? ftruncate(fd_, bytes) : 0;
+    const int err = errno;
+    release();
+    if (rc != 0) {
+      errno = err;
+      throw error("truncate");
+    }
+  }
+
+  bool is_open() const noexcept { return fd_ >= 0; }
+  bool writable() const noexcept { return writable_; }
+
+  /* Element access */
+  reference operator[](size_type pos) noexcept { return data_[pos]; }
+  const_reference operator[](size_type pos) const noexcept {
+    return data_[pos];
+  }
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("mmap_vector: out of range");
+    return data_[pos];
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("mmap_vector: out of range");
+    return data_[pos];
+  }
+  reference front() {
+    if (empty()) throw std::out_of_range("mmap_vector: vector is empty");
+    return data_[0];
+  }
+  const_reference front() const {
+    if (empty()) throw std::out_of_range("mmap_vector: vector is empty");
+    return data_[0];
+  }
+  reference back() {
+    if (empty()) throw std::out_of_range("mmap_vector: vector is empty");
+    return data_[size_ - 1];
+  }
+  const_reference back() const {
+    if (empty()) throw std::out_of_range("mmap_vector: vector is empty");
+    return data_[size_ - 1];
+  }
+  T *data() noexcept { return data_; }
+  const T *data() const noexcept { return data_; }
+
+  /* Iterators */
+  iterator begin() noexcept { return iterator(data_); }
+  iterator end() noexcept { return iterator(data_ + size_); }
+  const_iterator begin() const noexcept { return const_iterator(data_); }
+  const_iterator end() const noexcept {
+    return const_iterator(data_ + size_);
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  /* Capacity */
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept {
+    return static_cast<size_type>(std::numeric_limits<off_t>::max()) /
+           sizeof(T);
+  }
+
+  // grows the file and the mapping to n elements
+  void reserve(size_type n) {
+    require_writable();
+    if (n > max_size())
+      throw std::length_error("mmap_vector: vector is too big");
+    if (n > capacity_) remap(n);
+  }
+
+  void shrink_to_fit() {
+    require_writable();
+    if (capacity_ != size_) remap(size_);
+  }
+
+  /* Modifiers */
+  void clear() {
+    require_writable();
+    size_ = 0;
+  }
+
+  void push_back(const_reference value) {
+    require_writable();
+    if (size_ == capacity_) {
+      const T copy = value;  // value may live in the mapping
+      reserve(grow(size_ + 1));
+      data_[size_++] = copy;
+    } else {
+      data_[size_++] = value;
+    }
+  }
+
+  void pop_back() {
+    require_writable();
+    if (empty()) throw std::out_of_range("mmap_vector: vector is empty");
+    --size_;
+  }
+
+  // new elements are value-initialized
+  void resize(size_type n) {
+    require_writable();
+    if (n > capacity_) reserve(n);
+    for (size_type i = size_; i < n; ++i) data_[i] = T();
+    size_ = n;
+  }
+
+  void swap(mmap_vector &other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(fd_, other.fd_);
+    std::swap(writable_, other.writable_);
+  }
+
+  /* File */
+  // writes the dirty pages back to the file
+  void sync(bool wait = true) {
+    if (data_ == nullptr || !writable_) return;
+    if (msync(data_, size_ * sizeof(T), wait ? MS_SYNC : MS_ASYNC) != 0)
+      throw error("msync");
+  }
+
+  // tells the kernel how the elements [first, first + count) will be read
+  void advise(access_hint hint, size_type first = 0,
+              size_type count = static_cast<size_type>(-1)) {
+    if (data_ == nullptr || first >= size_) return;
+    if (count > size_ - first) count = size_ - first;
+    // madvise() wants a page aligned start
+    const std::size_t page = alloc_detail::page_size();
+    char *begin = reinterpret_cast<char *>(data_ + first);
+    char *aligned = reinterpret_cast<char *>(
+        reinterpret_cast<std::uintptr_t>(begin) / page * page);
+    const std::size_t length =
+        static_cast<std::size_t>(begin - aligned) + count * sizeof(T);
+    if (madvise(aligned, length, advice(hint)) != 0) throw error("madvise");
+  }
+
+ private:
+  static std::system_error error(const std::string &what) {
+    return std::system_error(errno, std::generic_category(),
+                             "mmap_vector: " + what);
+  }
+
+  static int advice(access_hint hint) noexcept {
+    switch (hint) {
+      case access_hint::sequential:
+        return MADV_SEQUENTIAL;
+      case access_hint::random:
+        return MADV_RANDOM;
+      case access_hint::will_need:
+        return MADV_WILLNEED;
+      case access_hint::dont_need:
+        return MADV_DONTNEED;
+      default:
+        return MADV_NORMAL;
+    }
+  }
+
+  void require_writable() const {
+    if (!writable_)
+      throw std::runtime_error("mmap_vector: vector is not writable");
+  }
+
+  // doubling, but at least a page worth of elements
+  size_type grow(size_type required) const noexcept {
+    const size_type page = alloc_detail::page_size() / sizeof(T);
+    size_type cap = capacity_ * 2;
+    if (cap < page) cap = page;
+    return cap < required ? required : cap;
+  }
+
+  // capacity_ stays 0 if mmap() fails, so nothing writes through data_
+  void map(size_type n) {
+    capacity_ = 0;
+    if (n == 0) return;
+    // a read-only file gets a private copy-on-write mapping, so writes
+    // through operator[] or data() touch only this process's pages
+    const int flags = writable_ ? MAP_SHARED : MAP_PRIVATE;
+    void *p = mmap(nullptr, n * sizeof(T), PROT_READ | PROT_WRITE, flags,
+                   fd_, 0);
+    if (p == MAP_FAILED) throw error("mmap");
+    data_ = static_cast<T *>(p);
+    capacity_ = n;
+  }
+
+  void unmap() noexcept {
+    if (data_ != nullptr) munmap(data_, capacity_ * sizeof(T));
+    data_ = nullptr;
+  }
+
+  // resizes the file, then moves or extends the mapping to cover it
+  void remap(size_type n) {
+    if (ftruncate(fd_, static_cast<off_t>(n * sizeof(T))) != 0)
+      throw error("truncate");
+#ifdef __linux__
+    if (data_ != nullptr && n != 0) {
+      void *p = mremap(data_, capacity_ * sizeof(T), n * sizeof(T),
+                       MREMAP_MAYMOVE);
+      if (p == MAP_FAILED) throw error("mremap");
+      data_ = static_cast<T *>(p);
+      capacity_ = n;
+      return;
+    }
+#endif
+    unmap();
+    try {
+      map(n);
+    } catch (...) {
+      // the elements are still in the file, but no longer mapped
+      size_ = 0;
+      throw;
+    }
+  }
+
+  // unmaps and closes the file as it is
+  void release() noexcept {
+    unmap();
+    if (fd_ >= 0) ::close(fd_);
+    fd_ = -1;
+    size_ = capacity_ = 0;
+    writable_ = false;
+  }
+
+  void close_noexcept() noexcept {
+    try {
+      close();
+    } catch (...) {
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // __unix__
+
+#endif  // S21_MMAP_VECTOR_H
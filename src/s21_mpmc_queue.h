@@ -0,0 +1,312 @@
+#ifndef S21_MPMC_QUEUE_H
+#define S21_MPMC_QUEUE_H
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#include "s21_containers_common.h"
+
+namespace s21 {
+
+/*
+ * Bounded lock-free queue for any number of producer and consumer threads
+ * (D. Vyukov's array queue). Every slot carries a sequence number telling
+ * which lap of the ring it is ready for: a producer claims position pos by
+ * a CAS on enqueue_pos_ once slot pos has sequence pos, and hands it over
+ * by storing pos + 1; a consumer claims it once the sequence is pos + 1 and
+ * frees it for the next lap with pos + capacity. Producers and consumers
+ * thus contend only on their own counter, and each slot sits on its own
+ * cache line. The capacity is rounded up to a power of two, at least 2.
+ *
+ * try_* calls never block. push/emplace/pop wait for room or an element:
+ * they spin with cpu_relax(), then yield, and finally park on a condition
+ * variable that the other side signals only while someone is parked.
+ * Element moves must not throw, since a claimed slot has to be handed on.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "mpmc_queue: T must be nothrow movable");
+
+  struct alignas(cache_line_size) cell {
+    std::atomic<std::size_t> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T *value() noexcept {
+      return std::launder(reinterpret_cast<T *>(storage));
+    }
+  };
+
+  using a_traits = std::allocator_traits<Allocator>;
+  using cell_allocator =
+      typename a_traits::template rebind_alloc<cell>;
+  using c_traits = std::allocator_traits<cell_allocator>;
+
+  static constexpr int kSpins = 64;
+  static constexpr int kYields = 16;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+ private:
+  // read-only after construction
+  Allocator alloc_;
+  cell_allocator cell_alloc_;
+  cell *cells_ = nullptr;
+  size_type mask_ = 0;
+
+  alignas(cache_line_size) std::atomic<size_type> enqueue_pos_{0};
+  alignas(cache_line_size) std::atomic<size_type> dequeue_pos_{0};
+
+  // parking lot of the blocking calls
+  alignas(cache_line_size) std::mutex park_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::atomic<int> parked_consumers_{0};
+  std::atomic<int> parked_producers_{0};
+
+ public:
+  /* Member functions */
+  // queue of at least capacity slots
+  explicit mpmc_queue(size_type capacity, const Allocator &alloc = Allocator())
+      : alloc_(alloc), cell_alloc_(alloc) {
+    if (capacity == 0) throw std::length_error("mpmc_queue: zero capacity");
+    if (capacity > c_traits::max_size(cell_alloc_) / 2)
+      throw std::length_error("mpmc_queue: too big");
+    // with one slot "full for consumers" and "free for the next lap"
+    // would be the same sequence number
+    size_type slots = 2;
+    while (slots < capacity) slots *= 2;
+    cells_ = c_traits::allocate(cell_alloc_, slots);
+    for (size_type i = 0; i < slots; ++i)
+      new (&cells_[i].sequence) std::atomic<size_type>(i);
+    mask_ = slots - 1;
+  }
+
+  // threads hold references to the queue, it never moves
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+  ~mpmc_queue() {
+    const size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+    for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+         pos != tail; ++pos)
+      a_traits::destroy(alloc_, at(pos).value());
+    c_traits::deallocate(cell_alloc_, cells_, mask_ + 1);
+  }
+
+  /* Capacity */
+  size_type capacity() const noexcept { return mask_ + 1; }
+  // approximate while other threads push or pop
+  size_type size() const noexcept {
+    const size_type head = dequeue_pos_.load(std::memory_order_acquire);
+    const size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+  bool empty() const noexcept { return size() == 0; }
+
+  /* Non-blocking */
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  // constructs an element in a free slot, false when the queue is full
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    if (!put(std::forward<Args>(args)...)) return false;
+    wake(parked_consumers_, not_empty_);
+    return true;
+  }
+
+  // moves the oldest element into out, false when the queue is empty
+  bool try_pop(reference out) {
+    if (!get(out)) return false;
+    wake(parked_producers_, not_full_);
+    return true;
+  }
+
+  // Pushes up to n elements copied (or moved, through a move iterator)
+  // from first into consecutive slots claimed with one CAS; returns how
+  // many went in. Elements whose copy may throw go in one by one.
+  template <typename InputIt>
+  size_type try_push_bulk(InputIt first, size_type n) {
+    size_type pos, count = 0;
+    if constexpr (std::is_nothrow_constructible_v<T, decltype(*first)>) {
+      count = claim_run(enqueue_pos_, 0, n, pos);
+      for (size_type i = 0; i < count; ++i, ++first) {
+        a_traits::construct(
+            alloc_, at(pos + i).value(), *first);
+        publish(pos + i, 1);
+      }
+    } else {
+      for (; count < n && put(*first); ++count, ++first) {
+      }
+    }
+    if (count) wake(parked_consumers_, not_empty_);
+    return count;
+  }
+
+  // Moves up to max of the oldest elements to out, returns how many.
+  // Assigning to *out must not throw.
+  template <typename OutputIt>
+  size_type try_pop_bulk(OutputIt out, size_type max) {
+    size_type pos, count = claim_run(dequeue_pos_, 1, max, pos);
+    for (size_type i = 0; i < count; ++i, ++out) {
+      T *item = at(pos + i).value();
+      *out = std::move(*item);
+      a_traits::destroy(alloc_, item);
+      publish(pos + i, mask_ + 1);
+    }
+    if (count) wake(parked_producers_, not_full_);
+    return count;
+  }
+
+  /* Blocking */
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  // waits for a free slot and constructs the element there
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    T item(std::forward<Args>(args)...);
+    wait_until(parked_producers_, not_full_,
+               [&] { return put(std::move(item)); });
+    wake(parked_consumers_, not_empty_);
+  }
+
+  // waits for an element and moves it into out
+  void pop(reference out) {
+    wait_until(parked_consumers_, not_empty_, [&] { return get(out); });
+    wake(parked_producers_, not_full_);
+  }
+
+  // waits for an element and returns it
+  value_type pop() {
+    value_type out;
+    pop(out);
+    return out;
+  }
+
+ private:
+  cell &at(size_type pos) const noexcept { return cells_[pos & mask_]; }
+
+  // Claims the slot at counter for one operation: producers (lag 0) need
+  // sequence == pos, consumers (lag 1) need sequence == pos + 1. False when
+  // the slot is still a lap behind, i.e. the queue is full or empty.
+  bool claim(std::atomic<size_type> &counter, size_type lag,
+             size_type &pos) noexcept {
+    pos = counter.load(std::memory_order_relaxed);
+    for (;;) {
+      const std::intptr_t diff = static_cast<std::intptr_t>(
+          at(pos).sequence.load(std::memory_order_acquire) - (pos + lag));
+      if (diff == 0) {
+        if (counter.compare_exchange_weak(pos, pos + 1,
+                                          std::memory_order_relaxed))
+          return true;
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = counter.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Claims up to n consecutive ready slots with one CAS, returns how many.
+  // A slot found ready stays ready until its position is claimed.
+  size_type claim_run(std::atomic<size_type> &counter, size_type lag,
+                      size_type n, size_type &pos) noexcept {
+    pos = counter.load(std::memory_order_relaxed);
+    for (;;) {
+      size_type ready = 0;
+      while (ready < n && ready <= mask_ &&
+             at(pos + ready).sequence.load(std::memory_order_acquire) ==
+                 pos + ready + lag)
+        ++ready;
+      if (ready == 0) {
+        const std::intptr_t diff = static_cast<std::intptr_t>(
+            at(pos).sequence.load(std::memory_order_acquire) - (pos + lag));
+        if (diff < 0 || n == 0) return 0;
+        pos = counter.load(std::memory_order_relaxed);
+      } else if (counter.compare_exchange_weak(pos, pos + ready,
+                                               std::memory_order_relaxed)) {
+        return ready;
+      }
+    }
+  }
+
+  // hands slot pos to the other side: lag 1 to consumers, lag mask_ + 1
+  // (the next lap) to producers
+  void publish(size_type pos, size_type lag) noexcept {
+    at(pos).sequence.store(pos + lag, std::memory_order_release);
+  }
+
+  // try_emplace and try_pop without signalling the other side
+  template <typename... Args>
+  bool put(Args &&...args) {
+    if constexpr (std::is_nothrow_constructible_v<T, Args &&...>) {
+      size_type pos;
+      if (!claim(enqueue_pos_, 0, pos)) return false;
+      a_traits::construct(
+          alloc_, at(pos).value(), std::forward<Args>(args)...);
+      publish(pos, 1);
+      return true;
+    } else {
+      // a throw after the claim would leave a hole in the ring
+      return put(T(std::forward<Args>(args)...));
+    }
+  }
+
+  bool get(reference out) noexcept {
+    size_type pos;
+    if (!claim(dequeue_pos_, 1, pos)) return false;
+    T *item = at(pos).value();
+    out = std::move(*item);
+    a_traits::destroy(alloc_, item);
+    publish(pos, mask_ + 1);
+    return true;
+  }
+
+  // Signals parked threads of the other side. The fence pairs with the
+  // one in wait_until: either the parked thread sees our slot update when
+  // it re-checks, or we see it counted in parked.
+  void wake(std::atomic<int> &parked, std::condition_variable &cv) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked.load(std::memory_order_relaxed) > 0) {
+      std::lock_guard<std::mutex> lock(park_);
+      cv.notify_all();
+    }
+  }
+
+  // Spins, then yields, then parks until attempt() succeeds. The parked
+  // attempts run under park_, so they must not call wake().
+  template <typename Attempt>
+  void wait_until(std::atomic<int> &parked, std::condition_variable &cv,
+                  Attempt &&attempt) {
+    for (int i = 0; i < kSpins; ++i) {
+      if (attempt()) return;
+      cpu_relax();
+    }
+    for (int i = 0; i < kYields; ++i) {
+      if (attempt()) return;
+      std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> lock(park_);
+    parked.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!attempt()) cv.wait(lock);
+    parked.fetch_sub(1, std::memory_order_relaxed);
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_MPMC_QUEUE_H
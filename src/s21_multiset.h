@@ -5,57 +5,64 @@
 
 namespace s21 {
 
-template <typename Key>
-class multiset : public BinaryTree<Key> {
+template <typename Key, typename Allocator = std::allocator<Key>>
+class multiset : public BinaryTree<Key, Allocator> {
+  using tree_type = BinaryTree<Key, Allocator>;
+
  public:
   using key_type = Key;
   using value_type = Key;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename BinaryTree<value_type>::iterator;
-  using const_iterator = typename BinaryTree<value_type>::const_iterator;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using size_type = size_t;
 
   /* Member functions */
   // default constructor
   multiset() {}
 
+  // creates empty multiset that allocates through a copy of alloc
+  explicit multiset(const Allocator &alloc) : tree_type(alloc) {}
+
   // initializer list constructor
-  multiset(std::initializer_list<value_type> const &items) {
+  multiset(std::initializer_list<value_type> const &items,
+           const Allocator &alloc = Allocator())
+      : tree_type(alloc) {
     for (const auto &item : items) {
       insert(item);
     }
   }
 
   // copy constructor
-  multiset(const multiset &ms) : BinaryTree<value_type>(ms) {}
+  multiset(const multiset &ms) : tree_type(ms) {}
 
   // move constructor
-  multiset(multiset &&ms) noexcept : BinaryTree<value_type>(std::move(ms)) {}
+  multiset(multiset &&ms) noexcept : tree_type(std::move(ms)) {}
 
   // destructor
   ~multiset() noexcept {}
 
   // move assignment operator
   multiset &operator=(multiset &&ms) {
-    BinaryTree<value_type>::operator=(std::move(ms));
+    tree_type::operator=(std::move(ms));
     return *this;
   }
 
   /* Iterators */
-  using BinaryTree<value_type>::begin;
-  using BinaryTree<value_type>::end;
+  using tree_type::begin;
+  using tree_type::end;
 
   /* Capacity */
-  using BinaryTree<value_type>::empty;
-  using BinaryTree<value_type>::size;
-  using BinaryTree<value_type>::max_size;
+  using tree_type::empty;
+  using tree_type::size;
+  using tree_type::max_size;
 
   /* Modifiers */
-  using BinaryTree<value_type>::clear;
+  using tree_type::clear;
 
   iterator insert(const value_type &value) {
-    return BinaryTree<value_type>::insert(value, true).first;
+    return tree_type::insert(value, true).first;
   }
 
   template <typename... Args>
@@ -63,17 +70,16 @@ class multiset : public BinaryTree<Key> {
     s21::vector<std::pair<iterator, bool>> results;
     if constexpr (sizeof...(args) == 0) return results;
 
-    (results.push_back(
-         BinaryTree<value_type>::insert(std::forward<Args>(args), true)),
+    (results.push_back(tree_type::insert(std::forward<Args>(args), true)),
      ...);
     return results;
   }
 
-  using BinaryTree<value_type>::erase;
+  using tree_type::erase;
 
   void swap(multiset &other) noexcept { std::swap(*this, other); }
 
-  void merge(multiset &other) { BinaryTree<value_type>::merge(other, true); }
+  void merge(multiset &other) { tree_type::merge(other, true); }
 
   /* Lookup */
   size_type count(const Key &key) {
@@ -85,8 +91,8 @@ class multiset : public BinaryTree<Key> {
     return result;
   }
 
-  using BinaryTree<value_type>::find;
-  using BinaryTree<value_type>::contains;
+  using tree_type::find;
+  using tree_type::contains;
 
   std::pair<iterator, iterator> equal_range(const Key &key) {
     return {lower_bound(key), upper_bound(key)};
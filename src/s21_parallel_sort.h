@@ -0,0 +1,203 @@
+#ifndef S21_PARALLEL_SORT_H
+#define S21_PARALLEL_SORT_H
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <thread>
+
+#include "s21_vector.h"
+#include "s21_array.h"
+
+namespace s21 {
+
+struct parallel_sort_options {
+  // worker threads, 0 means std::thread::hardware_concurrency()
+  unsigned threads = 0;
+  // ranges up to this many elements are sorted sequentially
+  std::size_t cutoff = std::size_t{1} << 15;
+};
+
+namespace sort_detail {
+
+// Calls fn(i) for every i in [0, tasks) on up to `threads` threads, the
+// calling one included. The first exception thrown by a task is rethrown.
+template <typename F>
+void run_parallel(std::size_t tasks, unsigned threads, F &&fn) {
+  std::atomic<std::size_t> next{0};
+  std::exception_ptr error;
+  std::atomic<bool> failed{false};
+  auto worker = [&] {
+    for (std::size_t i; (i = next.fetch_add(1)) < tasks;) {
+      try {
+        fn(i);
+      } catch (...) {
+        if (!failed.exchange(true)) error = std::current_exception();
+      }
+    }
+  };
+  if (tasks == 0) return;
+  const std::size_t extra = std::min<std::size_t>(threads, tasks) - 1;
+  std::unique_ptr<std::thread[]> pool(new std::thread[extra]);
+  std::size_t started = 0;
+  try {
+    for (; started < extra; ++started) pool[started] = std::thread(worker);
+  } catch (...) {
+    // too few threads is not fatal, the remaining ones take the tasks
+  }
+  worker();
+  for (std::size_t i = 0; i < started; ++i) pool[i].join();
+  if (error) std::rethrow_exception(error);
+}
+
+// Number of elements taken from a when the first k elements of the stable
+// merge of a[0, m) and b[0, n) are produced.
+template <typename T, typename Compare>
+std::size_t co_rank(std::size_t k, const T *a, std::size_t m, const T *b,
+                    std::size_t n, Compare &comp) {
+  std::size_t lo = k > n ? k - n : 0, hi = std::min(k, m);
+  while (lo < hi) {
+    const std::size_t i = lo + (hi - lo) / 2, j = k - i;
+    if (j > 0 && i < m && !comp(b[j - 1], a[i]))
+      lo = i + 1;
+    else
+      hi = i;
+  }
+  return lo;
+}
+
+// Scratch buffer holding n elements move-constructed from data.
+template <typename T>
+class scratch {
+  T *buf_;
+  std::size_t n_;
+
+ public:
+  scratch(T *data, std::size_t n)
+      : buf_(std::allocator<T>().allocate(n)), n_(n) {
+    try {
+      std::uninitialized_move(data, data + n, buf_);
+    } catch (...) {
+      std::allocator<T>().deallocate(buf_, n_);
+      throw;
+    }
+  }
+  ~scratch() {
+    std::destroy(buf_, buf_ + n_);
+    std::allocator<T>().deallocate(buf_, n_);
+  }
+  scratch(const scratch &) = delete;
+  scratch &operator=(const scratch &) = delete;
+  T *get() const noexcept { return buf_; }
+};
+
+/*
+ * Parallel merge sort: the range is cut into one run per thread, the runs
+ * are sorted concurrently, then merged pairwise between data and a scratch
+ * buffer. When fewer pairs than threads remain, each merge is split into
+ * independent pieces at co-rank positions so every round keeps all threads
+ * busy. Merging takes ties from the left run, so the result is stable when
+ * the runs are sorted with std::stable_sort.
+ */
+template <typename T, typename Compare>
+void merge_sort(T *data, std::size_t n, Compare comp,
+                parallel_sort_options opt, bool stable) {
+  unsigned threads =
+      opt.threads ? opt.threads : std::thread::hardware_concurrency();
+  if (threads == 0) threads = 1;
+  const std::size_t cutoff = std::max<std::size_t>(opt.cutoff, 2);
+  auto sort_run = [&](T *first, T *last) {
+    if (stable)
+      std::stable_sort(first, last, comp);
+    else
+      std::sort(first, last, comp);
+  };
+  if (threads == 1 || n <= cutoff) {
+    sort_run(data, data + n);
+    return;
+  }
+
+  std::size_t runs =
+      std::min<std::size_t>(threads, (n + cutoff - 1) / cutoff);
+  // run r is [bounds[r], bounds[r + 1])
+  vector<std::size_t> bounds;
+  for (std::size_t r = 0; r <= runs; ++r) bounds.push_back(n * r / runs);
+  run_parallel(runs, threads, [&](std::size_t r) {
+    sort_run(data + bounds[r], data + bounds[r + 1]);
+  });
+  if (runs == 1) return;
+
+  scratch<T> buffer(data, n);
+  T *src = data, *dst = buffer.get();
+  while (runs > 1) {
+    const std::size_t pairs = runs / 2;
+    const std::size_t pieces = std::max<std::size_t>(1, threads / pairs);
+    const std::size_t tasks = pairs * pieces + runs % 2;
+    run_parallel(tasks, threads, [&](std::size_t t) {
+      const std::size_t p = t / pieces;
+      if (p == pairs) {  // odd run out, carried over unchanged
+        std::move(src + bounds[2 * p], src + bounds[2 * p + 1],
+                  dst + bounds[2 * p]);
+        return;
+      }
+      const std::size_t lo = bounds[2 * p], mid = bounds[2 * p + 1],
+                        hi = bounds[2 * p + 2];
+      const T *a = src + lo, *b = src + mid;
+      const std::size_t m = mid - lo, len = hi - lo, piece = t % pieces;
+      const std::size_t k0 = len * piece / pieces;
+      const std::size_t k1 = len * (piece + 1) / pieces;
+      const std::size_t i0 = co_rank(k0, a, m, b, len - m, comp);
+      const std::size_t i1 = co_rank(k1, a, m, b, len - m, comp);
+      std::merge(std::make_move_iterator(src + lo + i0),
+                 std::make_move_iterator(src + lo + i1),
+                 std::make_move_iterator(src + mid + (k0 - i0)),
+                 std::make_move_iterator(src + mid + (k1 - i1)),
+                 dst + lo + k0, comp);
+    });
+    for (std::size_t r = 0; r < pairs; ++r) bounds[r + 1] = bounds[2 * r + 2];
+    if (runs % 2) bounds[pairs + 1] = bounds[runs];
+    runs = pairs + runs % 2;
+    std::swap(src, dst);
+  }
+  if (src != data) {
+    run_parallel(threads, threads, [&](std::size_t t) {
+      std::move(src + n * t / threads, src + n * (t + 1) / threads,
+                data + n * t / threads);
+    });
+  }
+}
+
+}  // namespace sort_detail
+
+/* Sorts s21::vector and s21::array with a parallel merge sort.
+ * parallel_sort does not keep the order of equal elements,
+ * parallel_stable_sort does. */
+template <typename T, typename A, typename G, typename Compare = std::less<T>>
+void parallel_sort(vector<T, A, G> &v, Compare comp = Compare(),
+                   parallel_sort_options opt = {}) {
+  sort_detail::merge_sort(v.data(), v.size(), comp, opt, false);
+}
+
+template <typename T, typename A, typename G, typename Compare = std::less<T>>
+void parallel_stable_sort(vector<T, A, G> &v, Compare comp = Compare(),
+                          parallel_sort_options opt = {}) {
+  sort_detail::merge_sort(v.data(), v.size(), comp, opt, true);
+}
+
+template <typename T, std::size_t N, typename Compare = std::less<T>>
+void parallel_sort(array<T, N> &a, Compare comp = Compare(),
+                   parallel_sort_options opt = {}) {
+  sort_detail::merge_sort(a.data(), N, comp, opt, false);
+}
+
+template <typename T, std::size_t N, typename Compare = std::less<T>>
+void parallel_stable_sort(array<T, N> &a, Compare comp = Compare(),
+                          parallel_sort_options opt = {}) {
+  sort_detail::merge_sort(a.data(), N, comp, opt, true);
+}
+
+}  // namespace s21
+
+#endif  // S21_PARALLEL_SORT_H
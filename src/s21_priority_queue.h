@@ -0,0 +1,176 @@
+#ifndef S21_PRIORITY_QUEUE_H
+#define S21_PRIORITY_QUEUE_H
+#pragma once
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+
+#include "s21_containers_common.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Heap adapter: top() is the greatest element under Compare (the smallest
+// with std::greater). The elements form a 4-ary heap in Container, a
+// random access sequence with push_back/emplace_back and pop_back: node i
+// has its children at 4i + 1 .. 4i + 4, so a heap of n elements is only
+// log4(n) levels deep and the four children compared at each level of a
+// pop sit in one or two cache lines. Building from a range heapifies in
+// O(n) instead of n pushes.
+template <typename T, typename Container = vector<T>,
+          typename Compare = std::less<typename Container::value_type>>
+class priority_queue : public s21_container_adapter {
+ public:
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+ protected:
+  Container c;
+  Compare comp;
+
+  static constexpr size_type kArity = 4;
+
+ public:
+  /* Member functions */
+  priority_queue() = default;
+  explicit priority_queue(const Compare &compare) : comp(compare) {}
+
+  // takes the elements of cont and heapifies them in O(n)
+  priority_queue(const Compare &compare, const Container &cont)
+      : c(cont), comp(compare) {
+    make_heap();
+  }
+  priority_queue(const Compare &compare, Container &&cont)
+      : c(std::move(cont)), comp(compare) {
+    make_heap();
+  }
+
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last,
+                 const Compare &compare = Compare())
+      : comp(compare) {
+    for (; first != last; ++first) c.push_back(*first);
+    make_heap();
+  }
+
+  priority_queue(std::initializer_list<value_type> const &items,
+                 const Compare &compare = Compare())
+      : priority_queue(items.begin(), items.end(), compare) {}
+
+  /* Element access */
+  const_reference top() const {
+    if (empty()) throw std::out_of_range("priority_queue: queue is empty");
+    return c[0];
+  }
+
+  /* Capacity */
+  bool empty() const { return c.empty(); }
+  size_type size() const { return c.size(); }
+  // returns the allocator of the underlying container
+  auto get_allocator() const { return c.get_allocator(); }
+
+  /* Modifiers */
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    c.emplace_back(std::forward<Args>(args)...);
+    sift_up(c.size() - 1);
+  }
+
+  // Appends [first, last), then restores the heap either by sifting each
+  // new element up or, when that would cost more, by heapifying the whole
+  // container in O(n).
+  template <typename InputIt>
+  void push_bulk(InputIt first, InputIt last) {
+    const size_type old_size = c.size();
+    try {
+      for (; first != last; ++first) c.push_back(*first);
+    } catch (...) {
+      restore(old_size);
+      throw;
+    }
+    restore(old_size);
+  }
+
+  // removes top()
+  void pop() {
+    if (empty()) throw std::out_of_range("priority_queue: queue is empty");
+    const size_type n = c.size() - 1;
+    if (n > 0) {
+      value_type last = std::move(c[n]);
+      c.pop_back();
+      sift_down(0, std::move(last));
+    } else {
+      c.pop_back();
+    }
+  }
+
+  void swap(priority_queue &other) noexcept {
+    c.swap(other.c);
+    std::swap(comp, other.comp);
+  }
+
+ private:
+  // fixes the heap after elements were appended from index old_size on
+  void restore(size_type old_size) {
+    const size_type added = c.size() - old_size;
+    if (added == 0) return;
+    size_type depth = 0;
+    for (size_type n = c.size(); n > 1; n /= kArity) ++depth;
+    if (added * depth > c.size()) {
+      make_heap();
+    } else {
+      for (size_type i = old_size; i < c.size(); ++i) sift_up(i);
+    }
+  }
+
+  // Floyd's bottom-up construction, O(n)
+  void make_heap() {
+    const size_type n = c.size();
+    if (n < 2) return;
+    for (size_type i = (n - 2) / kArity + 1; i-- > 0;) {
+      value_type value = std::move(c[i]);
+      sift_down(i, std::move(value));
+    }
+  }
+
+  // moves the element at i towards the root until its parent is not less
+  void sift_up(size_type i) {
+    if (i == 0) return;
+    value_type value = std::move(c[i]);
+    while (i > 0) {
+      const size_type parent = (i - 1) / kArity;
+      if (!comp(c[parent], value)) break;
+      c[i] = std::move(c[parent]);
+      i = parent;
+    }
+    c[i] = std::move(value);
+  }
+
+  // places value, taken out of the hole at i, in the subtree under i
+  void sift_down(size_type i, value_type &&value) {
+    const size_type n = c.size();
+    for (;;) {
+      const size_type first = i * kArity + 1;
+      if (first >= n) break;
+      const size_type last = first + kArity < n ? first + kArity : n;
+      size_type best = first;
+      for (size_type child = first + 1; child < last; ++child)
+        if (comp(c[best], c[child])) best = child;
+      if (!comp(value, c[best])) break;
+      c[i] = std::move(c[best]);
+      i = best;
+    }
+    c[i] = std::move(value);
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_PRIORITY_QUEUE_H
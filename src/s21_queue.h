@@ -2,88 +2,31 @@
 #define _S21_QUEUE_H 1
 #pragma once
 #include "s21_containers_common.h"
+#include "s21_ring_buffer.h"
 
 namespace s21 {
 
-template <typename T>
-class QueueNode {
-  T data;
-  QueueNode *next = nullptr;
-
- public:
-  QueueNode(const T &value) : data(value) {}
-
-  QueueNode(QueueNode *prev, const T &value) : data(value) {
-    splice_after(prev);
-  }
-  QueueNode(const T &value, QueueNode *next_node) : data(value) {
-    splice_before(next_node);
-  }
-
-  QueueNode *getNext() { return next; }
-  T &getData() { return data; }
-  T *pointer() { return &data; }
-
-  void splice_after(QueueNode *prev) noexcept {
-    if (prev != nullptr) prev->next = this;
-  }
-  void splice_before(QueueNode *next_node) noexcept { next = next_node; }
-};
-
-template <typename T, bool is_const = false>
-class QueueIterator_base {
- public:
-  using pointer = std::conditional_t<is_const, const T *, T *>;
-  using reference = std::conditional_t<is_const, const T &, T &>;
-  using value_type = T;
-  using iterator_category = std::forward_iterator_tag;
-  using node_type = QueueNode<T>;
-
- private:
-  node_type *node_;
-
- public:
-  QueueIterator_base() = delete;
-  QueueIterator_base(node_type *node) : node_(node) {}
-  reference operator*() noexcept { return node_->getData(); }
-  pointer operator->() { return node_->pointer(); }
-
-  QueueIterator_base &operator++() {
-    if (node_ != nullptr) node_ = node_->getNext();
-    return *this;
-  }
-
-  QueueIterator_base operator++(int) {
-    QueueIterator_base temp = *this;
-    ++(*this);
-    return temp;
-  }
-
-  bool operator==(const QueueIterator_base &other) const {
-    return node_ == other.node_;
-  }
-
-  bool operator!=(const QueueIterator_base &other) const {
-    return !(*this == other);
-  }
-};
-
-template <typename T>
-class queue : public s21_sequence_container {
+// FIFO adapter. Container needs push_back/emplace_back, front, back, size
+// and iterators, plus pop_front or else erase(begin()): the default
+// ring_buffer keeps the elements in one block and stops allocating once it
+// reaches the working size, while s21::list, s21::deque or
+// s21::unrolled_list can be plugged in instead. s21::vector works too, but
+// pays O(n) for every pop.
+template <typename T, typename Container = ring_buffer<T>>
+class queue : public s21_container_adapter {
  public:
+  using container_type = Container;
   using value_type = T;   // the template parameter T
   using reference = T &;  // defines the type of the reference to an element
   using const_reference =
       const T &;             // defines the type of the constant reference
   using size_type = size_t;  // defines the type of the container size (standard
                              // type is size_t)
-  using iterator = QueueIterator_base<T, false>;
-  using const_iterator = QueueIterator_base<T, true>;
+  using iterator = typename Container::iterator;
+  using const_iterator = typename Container::const_iterator;
 
- private:
-  size_type size_ = 0;
-  QueueNode<T> *front_ = nullptr;
-  QueueNode<T> *back_ = nullptr;
+ protected:
+  Container c;
 
  public:
   // default constructor, creates empty queue
@@ -97,84 +40,87 @@ class queue : public s21_sequence_container {
     }
   }
 
-  // copy constructor
-  queue(const queue &q) : queue() { *this = q; };
-  // move constructor
-  queue(queue &&q) : queue() { *this = std::forward<queue<T>>(q); };
+  // wraps an existing container, its front is the front of the queue
+  explicit queue(const Container &cont) : c(cont) {}
+  explicit queue(Container &&cont) : c(std::move(cont)) {}
 
-  // destructor
-  ~queue() {
-    while (!empty()) pop();
+  // builds the container from alloc, so several adapters can share one
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator_v<Container, Alloc>>>
+  explicit queue(const Alloc &alloc) : c(alloc) {}
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator_v<Container, Alloc>>>
+  queue(std::initializer_list<value_type> const &items, const Alloc &alloc)
+      : c(alloc) {
+    for (const auto &item : items) push(item);
   }
 
-  // assignment operator overload for copying object
-  queue &operator=(const queue &q) {
-    if (this != &q) {
-      while (size() > q.size()) {
-        pop();
-      }
-      iterator it(front_);
-      iterator qit(q.front_);
-      iterator it_end(nullptr);
+  // copy constructor
+  queue(const queue &q) = default;
+  // move constructor
+  queue(queue &&q) noexcept : queue() { swap(q); };
 
-      while (it != it_end && qit != it_end) {
-        *it = *qit;
-        ++it;
-        ++qit;
-      }
-      while (size() < q.size()) {
-        this->push(*(qit++));
-      }
-    }
-    return *this;
-  }
+  // assignment operator overload for copying object
+  queue &operator=(const queue &q) = default;
   // assignment operator overload for moving object
-  queue &operator=(queue &&q) {
+  queue &operator=(queue &&q) noexcept {
     swap(q);
     return *this;
   }
 
   /*Queue Element access*/
   // access the first element
+  reference front() {
+    if (empty()) throw std::out_of_range("queue: queue is empty");
+    return c.front();
+  }
   const_reference front() const {
     if (empty()) throw std::out_of_range("queue: queue is empty");
-    return front_->getData();
+    return c.front();
   }
   // access the last element
+  reference back() {
+    if (empty()) throw std::out_of_range("queue: queue is empty");
+    return c.back();
+  }
   const_reference back() const {
     if (empty()) throw std::out_of_range("queue: queue is empty");
-    return back_->getData();
+    return c.back();
   }
 
+  /*Queue Iterators, from the front to the back*/
+  iterator begin() noexcept { return c.begin(); }
+  iterator end() noexcept { return c.end(); }
+  const_iterator begin() const noexcept { return c.cbegin(); }
+  const_iterator end() const noexcept { return c.cend(); }
+
   /*Queue Capacity*/
   // checks whether the container is empty
-  bool empty() const { return (size() == 0); }
+  bool empty() const { return c.empty(); }
   // returns the number of elements
-  size_type size() const { return size_; }
+  size_type size() const { return c.size(); }
+  // returns the allocator of the underlying container
+  auto get_allocator() const { return c.get_allocator(); }
 
   /*Queue Modifiers*/
   // inserts an element at the end
-  void push(const_reference value) {
-    if (empty())
-      front_ = back_ = new QueueNode(value);
-    else
-      back_ = new QueueNode(back_, value);
-    size_++;
+  void push(const_reference value) { c.push_back(value); }
+  void push(value_type &&value) { c.push_back(std::move(value)); }
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    return c.emplace_back(std::forward<Args>(args)...);
   }
   // removes the first element
   void pop() {
     if (empty()) throw std::out_of_range("queue: queue is empty");
-    auto temp = front_;
-    front_ = front_->getNext();
-    delete temp;
-    --size_;
-    if (empty()) back_ = nullptr;
+    if constexpr (has_pop_front<Container>::value)
+      c.pop_front();
+    else
+      c.erase(c.begin());
   }
   // swaps the contents
-  void swap(queue &other) {
-    std::swap(front_, other.front_);
-    std::swap(back_, other.back_);
-    std::swap(size_, other.size_);
+  void swap(queue &other) noexcept {
+    c.swap(other.c);
   }
 
   template <class... Args>
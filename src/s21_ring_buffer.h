@@ -0,0 +1,365 @@
+#ifndef S21_RING_BUFFER_H
+#define S21_RING_BUFFER_H
+#pragma once
+#include <iterator>
+#include <stdexcept>
+
+#include "s21_containers_common.h"
+
+namespace s21 {
+
+// Tag selecting the bounded ring_buffer constructor.
+struct fixed_capacity_t {
+  explicit fixed_capacity_t() = default;
+};
+inline constexpr fixed_capacity_t fixed_capacity{};
+
+template <typename T, bool is_const = false>
+class RingIterator_base {
+ public:
+  using pointer = std::conditional_t<is_const, const T *, T *>;
+  using reference = std::conditional_t<is_const, const T &, T &>;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+
+ private:
+  T *data_;
+  std::size_t mask_;
+  // unwrapped position: the slot is pos_ & mask_
+  std::size_t pos_;
+
+ public:
+  RingIterator_base(T *data, std::size_t mask, std::size_t pos) noexcept
+      : data_(data), mask_(mask), pos_(pos) {}
+  // iterator -> const_iterator conversion
+  template <bool c = is_const, typename = std::enable_if_t<c>>
+  RingIterator_base(const RingIterator_base<T, false> &other) noexcept
+      : data_(other.data()), mask_(other.mask()), pos_(other.position()) {}
+
+  reference operator*() const noexcept { return data_[pos_ & mask_]; }
+  pointer operator->() const noexcept { return &**this; }
+  reference operator[](difference_type n) const noexcept {
+    return data_[(pos_ + n) & mask_];
+  }
+
+  RingIterator_base &operator++() noexcept {
+    ++pos_;
+    return *this;
+  }
+  RingIterator_base operator++(int) noexcept {
+    return RingIterator_base(data_, mask_, pos_++);
+  }
+  RingIterator_base &operator--() noexcept {
+    --pos_;
+    return *this;
+  }
+  RingIterator_base operator--(int) noexcept {
+    return RingIterator_base(data_, mask_, pos_--);
+  }
+  RingIterator_base &operator+=(difference_type n) noexcept {
+    pos_ += n;
+    return *this;
+  }
+  RingIterator_base &operator-=(difference_type n) noexcept {
+    pos_ -= n;
+    return *this;
+  }
+  RingIterator_base operator+(difference_type n) const noexcept {
+    return RingIterator_base(data_, mask_, pos_ + n);
+  }
+  RingIterator_base operator-(difference_type n) const noexcept {
+    return RingIterator_base(data_, mask_, pos_ - n);
+  }
+  difference_type operator-(const RingIterator_base &other) const noexcept {
+    return static_cast<difference_type>(pos_ - other.pos_);
+  }
+
+  bool operator==(const RingIterator_base &other) const noexcept {
+    return pos_ == other.pos_;
+  }
+  bool operator!=(const RingIterator_base &other) const noexcept {
+    return !(*this == other);
+  }
+  bool operator<(const RingIterator_base &other) const noexcept {
+    return static_cast<difference_type>(pos_ - other.pos_) < 0;
+  }
+  bool operator>(const RingIterator_base &other) const noexcept {
+    return other < *this;
+  }
+
+  T *data() const noexcept { return data_; }
+  std::size_t mask() const noexcept { return mask_; }
+  std::size_t position() const noexcept { return pos_; }
+};
+
+/*
+ * Circular buffer in one contiguous allocation of a power-of-two number of
+ * slots, so a logical index maps to a slot with a mask. Elements are pushed
+ * and popped at both ends in O(1) without allocating; when the ring is full
+ * it doubles, moving the elements into the new block unwrapped from slot 0.
+ * A buffer built with fixed_capacity never grows and throws
+ * std::length_error when pushed while full(). Iterators are invalidated by
+ * growth only.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class ring_buffer : public s21_sequence_container {
+  using a_traits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = RingIterator_base<T, false>;
+  using const_iterator = RingIterator_base<T, true>;
+  using allocator_type = Allocator;
+
+ private:
+  Allocator alloc_;
+  T *data_ = nullptr;
+  size_type capacity_ = 0;
+  // slot of the first element, always below capacity_
+  size_type head_ = 0;
+  size_type size_ = 0;
+  // most elements a fixed buffer holds, 0 when it grows
+  size_type limit_ = 0;
+
+ public:
+  /* Member functions */
+  ring_buffer() = default;
+
+  // allocates the slots through a copy of alloc
+  explicit ring_buffer(const Allocator &alloc) : alloc_(alloc) {}
+
+  // buffer of at most n elements that never reallocates
+  ring_buffer(fixed_capacity_t, size_type n) : limit_(n) {
+    if (n == 0) throw std::length_error("ring_buffer: zero fixed capacity");
+    reallocate(round_up(n));
+  }
+
+  ring_buffer(std::initializer_list<value_type> const &items,
+              const Allocator &alloc = Allocator())
+      : alloc_(alloc) {
+    reserve(items.size());
+    for (const auto &item : items) push_back(item);
+  }
+
+  ring_buffer(const ring_buffer &other)
+      : alloc_(a_traits::select_on_container_copy_construction(other.alloc_)),
+        limit_(other.limit_) {
+    if (fixed())
+      reallocate(round_up(limit_));
+    else
+      reserve(other.size_);
+    for (const auto &item : other) push_back(item);
+  }
+
+  ring_buffer(ring_buffer &&other) noexcept { swap(other); }
+
+  ~ring_buffer() {
+    clear();
+    if (data_ != nullptr) a_traits::deallocate(alloc_, data_, capacity_);
+  }
+
+  ring_buffer &operator=(const ring_buffer &other) {
+    if (this != &other) {
+      ring_buffer copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  ring_buffer &operator=(ring_buffer &&other) noexcept {
+    if (this != &other) swap(other);
+    return *this;
+  }
+
+  /* Element access */
+  reference operator[](size_type i) noexcept { return slot(i); }
+  const_reference operator[](size_type i) const noexcept { return slot(i); }
+
+  reference at(size_type i) {
+    if (i >= size_) throw std::out_of_range("ring_buffer: out of range");
+    return slot(i);
+  }
+  const_reference at(size_type i) const {
+    if (i >= size_) throw std::out_of_range("ring_buffer: out of range");
+    return slot(i);
+  }
+
+  reference front() {
+    if (empty()) throw std::out_of_range("ring_buffer: buffer is empty");
+    return slot(0);
+  }
+  const_reference front() const {
+    if (empty()) throw std::out_of_range("ring_buffer: buffer is empty");
+    return slot(0);
+  }
+  reference back() {
+    if (empty()) throw std::out_of_range("ring_buffer: buffer is empty");
+    return slot(size_ - 1);
+  }
+  const_reference back() const {
+    if (empty()) throw std::out_of_range("ring_buffer: buffer is empty");
+    return slot(size_ - 1);
+  }
+
+  /* Iterators */
+  iterator begin() noexcept { return iterator(data_, mask(), head_); }
+  iterator end() noexcept { return iterator(data_, mask(), head_ + size_); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cbegin() const noexcept {
+    return const_iterator(data_, mask(), head_);
+  }
+  const_iterator cend() const noexcept {
+    return const_iterator(data_, mask(), head_ + size_);
+  }
+
+  /* Capacity */
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return limit_ ? limit_ : capacity_; }
+  size_type max_size() const noexcept {
+    return (std::numeric_limits<size_type>::max() / 2 + 1) / sizeof(T);
+  }
+  bool full() const noexcept { return size_ == capacity(); }
+  bool fixed() const noexcept { return limit_ != 0; }
+  Allocator get_allocator() const { return alloc_; }
+
+  // makes room for n elements without further allocation
+  void reserve(size_type n) {
+    if (n <= capacity()) return;
+    if (fixed()) throw std::length_error("ring_buffer: buffer is full");
+    if (n > max_size()) throw std::length_error("ring_buffer: too big");
+    reallocate(round_up(n));
+  }
+
+  /* Modifiers */
+  void clear() noexcept {
+    destroy_elements();
+    head_ = size_ = 0;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (full()) {
+      grow(size_, std::forward<Args>(args)...);
+    } else {
+      a_traits::construct(alloc_, &slot(size_), std::forward<Args>(args)...);
+    }
+    return slot(size_++);
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    if (full()) {
+      // the new element lands in the last slot of the new block
+      grow(size_type(-1), std::forward<Args>(args)...);
+    } else {
+      a_traits::construct(alloc_, data_ + ((head_ - 1) & mask()),
+                          std::forward<Args>(args)...);
+    }
+    head_ = (head_ - 1) & mask();
+    ++size_;
+    return slot(0);
+  }
+
+  void pop_front() {
+    if (empty()) throw std::out_of_range("ring_buffer: buffer is empty");
+    a_traits::destroy(alloc_, &slot(0));
+    head_ = (head_ + 1) & mask();
+    --size_;
+  }
+
+  void pop_back() {
+    if (empty()) throw std::out_of_range("ring_buffer: buffer is empty");
+    a_traits::destroy(alloc_, &slot(size_ - 1));
+    --size_;
+  }
+
+  void swap(ring_buffer &other) noexcept {
+    std::swap(alloc_, other.alloc_);
+    std::swap(data_, other.data_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(limit_, other.limit_);
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  size_type mask() const noexcept { return capacity_ ? capacity_ - 1 : 0; }
+
+  T &slot(size_type i) const noexcept { return data_[(head_ + i) & mask()]; }
+
+  static size_type round_up(size_type n) noexcept {
+    size_type cap = 8;
+    while (cap < n) cap *= 2;
+    return cap;
+  }
+
+  // Doubles the block while constructing a new element from args at the
+  // unwrapped index at of the new block (size_ for the back, the last slot
+  // for the front) before the old elements move, so args may refer to them.
+  template <typename... Args>
+  void grow(size_type at, Args &&...args) {
+    if (fixed()) throw std::length_error("ring_buffer: buffer is full");
+    if (capacity_ >= max_size())
+      throw std::length_error("ring_buffer: too big");
+    const size_type new_cap = capacity_ ? capacity_ * 2 : 8;
+    T *fresh = a_traits::allocate(alloc_, new_cap);
+    T *target = fresh + (at < new_cap ? at : new_cap - 1);
+    try {
+      a_traits::construct(alloc_, target, std::forward<Args>(args)...);
+    } catch (...) {
+      a_traits::deallocate(alloc_, fresh, new_cap);
+      throw;
+    }
+    adopt(fresh, new_cap, target);
+  }
+
+  void reallocate(size_type new_cap) {
+    adopt(a_traits::allocate(alloc_, new_cap), new_cap, nullptr);
+  }
+
+  // moves the elements into fresh from slot 0 and frees the old block; on
+  // failure the extra element, if any, is destroyed with fresh
+  void adopt(T *fresh, size_type new_cap, T *extra) {
+    size_type moved = 0;
+    try {
+      for (; moved < size_; ++moved)
+        a_traits::construct(alloc_, fresh + moved,
+                            std::move_if_noexcept(slot(moved)));
+    } catch (...) {
+      for (size_type i = 0; i < moved; ++i)
+        a_traits::destroy(alloc_, fresh + i);
+      if (extra != nullptr) a_traits::destroy(alloc_, extra);
+      a_traits::deallocate(alloc_, fresh, new_cap);
+      throw;
+    }
+    destroy_elements();
+    if (data_ != nullptr) a_traits::deallocate(alloc_, data_, capacity_);
+    data_ = fresh;
+    capacity_ = new_cap;
+    head_ = 0;
+  }
+
+  void destroy_elements() noexcept {
+    for (size_type i = 0; i < size_; ++i) a_traits::destroy(alloc_, &slot(i));
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_RING_BUFFER_H
@@ -5,55 +5,62 @@
 
 namespace s21 {
 
-template <typename Key>
-class set : public BinaryTree<Key> {
+template <typename Key, typename Allocator = std::allocator<Key>>
+class set : public BinaryTree<Key, Allocator> {
+  using tree_type = BinaryTree<Key, Allocator>;
+
  public:
   using key_type = Key;
   using value_type = Key;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename BinaryTree<value_type>::iterator;
-  using const_iterator = typename BinaryTree<value_type>::const_iterator;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using size_type = size_t;
 
   /* Member functions */
   // default constructor
   set() {}
 
+  // creates empty set that allocates through a copy of alloc
+  explicit set(const Allocator &alloc) : tree_type(alloc) {}
+
   // initializer list constructor
-  set(std::initializer_list<value_type> const &items) {
+  set(std::initializer_list<value_type> const &items,
+      const Allocator &alloc = Allocator())
+      : tree_type(alloc) {
     for (const auto &item : items) {
       insert(item);
     }
   }
 
   // copy constructor
-  set(const set &s) : BinaryTree<value_type>(s) {}
+  set(const set &s) : tree_type(s) {}
 
   // move constructor
-  set(set &&s) noexcept : BinaryTree<value_type>(std::move(s)) {}
+  set(set &&s) noexcept : tree_type(std::move(s)) {}
 
   // destructor
   ~set() noexcept {}
 
   // move assignment operator
   set &operator=(set &&s) {
-    BinaryTree<value_type>::operator=(std::move(s));
+    tree_type::operator=(std::move(s));
     return *this;
   }
 
   /* Iterators */
-  using BinaryTree<value_type>::begin;
-  using BinaryTree<value_type>::end;
+  using tree_type::begin;
+  using tree_type::end;
 
   /* Capacity */
-  using BinaryTree<value_type>::empty;
-  using BinaryTree<value_type>::size;
-  using BinaryTree<value_type>::max_size;
+  using tree_type::empty;
+  using tree_type::size;
+  using tree_type::max_size;
 
   /* Modifiers */
-  using BinaryTree<value_type>::clear;
-  using BinaryTree<value_type>::insert;
+  using tree_type::clear;
+  using tree_type::insert;
 
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
@@ -64,15 +71,15 @@ class set : public BinaryTree<Key> {
     return results;
   }
 
-  using BinaryTree<value_type>::erase;
+  using tree_type::erase;
 
   void swap(set &other) noexcept { std::swap(*this, other); }
 
-  void merge(set &other) { BinaryTree<value_type>::merge(other); }
+  void merge(set &other) { tree_type::merge(other); }
 
   /* Lookup */
-  using BinaryTree<value_type>::find;
-  using BinaryTree<value_type>::contains;
+  using tree_type::find;
+  using tree_type::contains;
 };
 
 // deduction guide
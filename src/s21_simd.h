@@ -0,0 +1,493 @@
+#ifndef S21_SIMD_H
+#define S21_SIMD_H
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include "s21_vector.h"
+// s21_array.h is not self-contained, it goes after s21_vector.h
+#include "s21_array.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#define S21_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+/*
+ * Vectorized find, count, min_element, max_element, accumulate and contains
+ * for s21::vector and s21::array of int32_t, float and double, plus the
+ * popcount and bitwise word kernels behind s21::dynamic_bitset.
+ * x86 builds run AVX2 kernels when the CPU supports them (checked once at
+ * runtime, no -mavx2 needed) and SSE2 kernels otherwise; any other element
+ * type or architecture uses the scalar <algorithm> code.
+ * Floating-point accumulate() adds the lanes separately, so its rounding
+ * may differ from a left-to-right sum. min/max of ranges containing NaN fall
+ * back to the scalar code to keep the std::min_element semantics.
+ */
+namespace s21 {
+namespace simd {
+
+template <typename C>
+struct is_contiguous : std::false_type {};
+template <typename T, typename A, typename G>
+struct is_contiguous<vector<T, A, G>> : std::true_type {};
+template <typename T, std::size_t N>
+struct is_contiguous<array<T, N>> : std::true_type {};
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool vectorizable =
+    std::is_same_v<T, std::int32_t> || std::is_same_v<T, float> ||
+    std::is_same_v<T, double>;
+
+template <typename C>
+using enable_contiguous = std::enable_if_t<is_contiguous<std::decay_t<C>>{}>;
+
+enum class word_op { and_, or_, xor_, and_not };
+
+// dst[i] = dst[i] Op src[i] for i in [from, n)
+template <word_op Op>
+inline void combine_scalar(std::uint64_t *dst, const std::uint64_t *src,
+                           std::size_t from, std::size_t n) {
+  for (std::size_t i = from; i < n; ++i) {
+    if constexpr (Op == word_op::and_)
+      dst[i] &= src[i];
+    else if constexpr (Op == word_op::or_)
+      dst[i] |= src[i];
+    else if constexpr (Op == word_op::xor_)
+      dst[i] ^= src[i];
+    else
+      dst[i] &= ~src[i];
+  }
+}
+
+#ifdef S21_SIMD_X86
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+inline bool has_avx2() noexcept {
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  return avx2;
+}
+
+/* Register traits: one struct per instruction set and element type with the
+ * handful of operations the kernels below are written against. Masks have
+ * one bit per lane. */
+template <typename T>
+struct sse2;
+
+template <>
+struct sse2<std::int32_t> {
+  using T = std::int32_t;
+  using reg = __m128i;
+  static constexpr std::size_t lanes = 4;
+  static reg load(const T *p) {
+    return _mm_loadu_si128(reinterpret_cast<const reg *>(p));
+  }
+  static void store(T *p, reg a) {
+    _mm_storeu_si128(reinterpret_cast<reg *>(p), a);
+  }
+  static reg set1(T x) { return _mm_set1_epi32(x); }
+  static reg zero() { return _mm_setzero_si128(); }
+  static unsigned eq_mask(reg a, reg b) {
+    return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+  }
+  static unsigned nan_mask(reg) { return 0; }
+  // SSE2 has no pminsd/pmaxsd, select through a compare mask
+  static reg min(reg a, reg b) {
+    const reg gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+  }
+  static reg max(reg a, reg b) {
+    const reg gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+  }
+  static reg add(reg a, reg b) { return _mm_add_epi32(a, b); }
+};
+
+template <>
+struct sse2<float> {
+  using T = float;
+  using reg = __m128;
+  static constexpr std::size_t lanes = 4;
+  static reg load(const T *p) { return _mm_loadu_ps(p); }
+  static void store(T *p, reg a) { _mm_storeu_ps(p, a); }
+  static reg set1(T x) { return _mm_set1_ps(x); }
+  static reg zero() { return _mm_setzero_ps(); }
+  static unsigned eq_mask(reg a, reg b) {
+    return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+  }
+  static unsigned nan_mask(reg a) {
+    return _mm_movemask_ps(_mm_cmpunord_ps(a, a));
+  }
+  static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+  static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+};
+
+template <>
+struct sse2<double> {
+  using T = double;
+  using reg = __m128d;
+  static constexpr std::size_t lanes = 2;
+  static reg load(const T *p) { return _mm_loadu_pd(p); }
+  static void store(T *p, reg a) { _mm_storeu_pd(p, a); }
+  static reg set1(T x) { return _mm_set1_pd(x); }
+  static reg zero() { return _mm_setzero_pd(); }
+  static unsigned eq_mask(reg a, reg b) {
+    return _mm_movemask_pd(_mm_cmpeq_pd(a, b));
+  }
+  static unsigned nan_mask(reg a) {
+    return _mm_movemask_pd(_mm_cmpunord_pd(a, a));
+  }
+  static reg min(reg a, reg b) { return _mm_min_pd(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_pd(a, b); }
+  static reg add(reg a, reg b) { return _mm_add_pd(a, b); }
+};
+
+template <typename T>
+struct avx2;
+
+template <>
+struct avx2<std::int32_t> {
+  using T = std::int32_t;
+  using reg = __m256i;
+  static constexpr std::size_t lanes = 8;
+  S21_TARGET_AVX2 static reg load(const T *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const reg *>(p));
+  }
+  S21_TARGET_AVX2 static void store(T *p, reg a) {
+    _mm256_storeu_si256(reinterpret_cast<reg *>(p), a);
+  }
+  S21_TARGET_AVX2 static reg set1(T x) { return _mm256_set1_epi32(x); }
+  S21_TARGET_AVX2 static reg zero() { return _mm256_setzero_si256(); }
+  S21_TARGET_AVX2 static unsigned eq_mask(reg a, reg b) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+  }
+  S21_TARGET_AVX2 static unsigned nan_mask(reg) { return 0; }
+  S21_TARGET_AVX2 static reg min(reg a, reg b) {
+    return _mm256_min_epi32(a, b);
+  }
+  S21_TARGET_AVX2 static reg max(reg a, reg b) {
+    return _mm256_max_epi32(a, b);
+  }
+  S21_TARGET_AVX2 static reg add(reg a, reg b) {
+    return _mm256_add_epi32(a, b);
+  }
+};
+
+template <>
+struct avx2<float> {
+  using T = float;
+  using reg = __m256;
+  static constexpr std::size_t lanes = 8;
+  S21_TARGET_AVX2 static reg load(const T *p) { return _mm256_loadu_ps(p); }
+  S21_TARGET_AVX2 static void store(T *p, reg a) { _mm256_storeu_ps(p, a); }
+  S21_TARGET_AVX2 static reg set1(T x) { return _mm256_set1_ps(x); }
+  S21_TARGET_AVX2 static reg zero() { return _mm256_setzero_ps(); }
+  S21_TARGET_AVX2 static unsigned eq_mask(reg a, reg b) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+  }
+  S21_TARGET_AVX2 static unsigned nan_mask(reg a) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(a, a, _CMP_UNORD_Q));
+  }
+  S21_TARGET_AVX2 static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+  S21_TARGET_AVX2 static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+  S21_TARGET_AVX2 static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+};
+
+template <>
+struct avx2<double> {
+  using T = double;
+  using reg = __m256d;
+  static constexpr std::size_t lanes = 4;
+  S21_TARGET_AVX2 static reg load(const T *p) { return _mm256_loadu_pd(p); }
+  S21_TARGET_AVX2 static void store(T *p, reg a) { _mm256_storeu_pd(p, a); }
+  S21_TARGET_AVX2 static reg set1(T x) { return _mm256_set1_pd(x); }
+  S21_TARGET_AVX2 static reg zero() { return _mm256_setzero_pd(); }
+  S21_TARGET_AVX2 static unsigned eq_mask(reg a, reg b) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+  }
+  S21_TARGET_AVX2 static unsigned nan_mask(reg a) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(a, a, _CMP_UNORD_Q));
+  }
+  S21_TARGET_AVX2 static reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+  S21_TARGET_AVX2 static reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+  S21_TARGET_AVX2 static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+};
+
+/* Kernels. They are always inlined into the per-ISA entry points further
+ * down, which carry the matching target attribute. */
+#define S21_SIMD_KERNEL __attribute__((always_inline)) inline
+
+template <typename V, typename T>
+S21_SIMD_KERNEL std::size_t find_kernel(const T *p, std::size_t n, T value) {
+  const auto needle = V::set1(value);
+  std::size_t i = 0;
+  for (; i + V::lanes <= n; i += V::lanes) {
+    const unsigned mask = V::eq_mask(V::load(p + i), needle);
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  for (; i < n; ++i)
+    if (p[i] == value) return i;
+  return n;
+}
+
+template <typename V, typename T>
+S21_SIMD_KERNEL std::size_t count_kernel(const T *p, std::size_t n, T value) {
+  const auto needle = V::set1(value);
+  std::size_t i = 0, count = 0;
+  for (; i + V::lanes <= n; i += V::lanes)
+    count += __builtin_popcount(V::eq_mask(V::load(p + i), needle));
+  for (; i < n; ++i) count += p[i] == value;
+  return count;
+}
+
+// index of the first minimum (IsMax == false) or maximum, n when a NaN is
+// found so the caller can fall back to the scalar code
+template <typename V, bool IsMax, typename T>
+S21_SIMD_KERNEL std::size_t extreme_kernel(const T *p, std::size_t n) {
+  auto acc = V::load(p);
+  unsigned nan = V::nan_mask(acc);
+  std::size_t i = V::lanes;
+  for (; i + V::lanes <= n; i += V::lanes) {
+    const auto x = V::load(p + i);
+    nan |= V::nan_mask(x);
+    acc = IsMax ? V::max(acc, x) : V::min(acc, x);
+  }
+  if (nan) return n;
+  T lanes[V::lanes];
+  V::store(lanes, acc);
+  T best = lanes[0];
+  for (std::size_t l = 1; l < V::lanes; ++l)
+    if (IsMax ? best < lanes[l] : lanes[l] < best) best = lanes[l];
+  for (; i < n; ++i) {
+    if (p[i] != p[i]) return n;
+    if (IsMax ? best < p[i] : p[i] < best) best = p[i];
+  }
+  return find_kernel<V>(p, n, best);
+}
+
+template <typename V, typename T>
+S21_SIMD_KERNEL T sum_kernel(const T *p, std::size_t n, T init) {
+  using U = std::conditional_t<std::is_integral_v<T>, std::uint32_t, T>;
+  auto acc = V::zero();
+  std::size_t i = 0;
+  for (; i + V::lanes <= n; i += V::lanes) acc = V::add(acc, V::load(p + i));
+  T lanes[V::lanes];
+  V::store(lanes, acc);
+  // integers wrap around like the vector lanes instead of overflowing
+  U sum = static_cast<U>(init);
+  for (std::size_t l = 0; l < V::lanes; ++l) sum += static_cast<U>(lanes[l]);
+  for (; i < n; ++i) sum += static_cast<U>(p[i]);
+  return static_cast<T>(sum);
+}
+
+#undef S21_SIMD_KERNEL
+
+template <typename T>
+S21_TARGET_AVX2 std::size_t find_avx2(const T *p, std::size_t n, T value) {
+  return find_kernel<avx2<T>>(p, n, value);
+}
+template <typename T>
+S21_TARGET_AVX2 std::size_t count_avx2(const T *p, std::size_t n, T value) {
+  return count_kernel<avx2<T>>(p, n, value);
+}
+template <bool IsMax, typename T>
+S21_TARGET_AVX2 std::size_t extreme_avx2(const T *p, std::size_t n) {
+  return extreme_kernel<avx2<T>, IsMax>(p, n);
+}
+template <typename T>
+S21_TARGET_AVX2 T sum_avx2(const T *p, std::size_t n, T init) {
+  return sum_kernel<avx2<T>>(p, n, init);
+}
+
+/* Kernels over 64-bit words, used by dynamic_bitset. */
+inline bool has_popcnt() noexcept {
+  static const bool popcnt = __builtin_cpu_supports("popcnt");
+  return popcnt;
+}
+
+__attribute__((target("popcnt"))) inline std::size_t popcount_popcnt(
+    const std::uint64_t *p, std::size_t n) {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; ++i) count += __builtin_popcountll(p[i]);
+  return count;
+}
+
+// Nibble lookup with vpshufb, byte counters summed with vpsadbw every 31
+// rounds before they can overflow.
+__attribute__((target("avx2,popcnt"))) inline std::size_t popcount_avx2(
+    const std::uint64_t *p, std::size_t n) {
+  const __m256i lookup =
+      _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1,
+                       2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i nibble = _mm256_set1_epi8(0x0f);
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i total = zero;
+  std::size_t i = 0;
+  while (i + 4 <= n) {
+    __m256i bytes = zero;
+    for (int round = 0; round < 31 && i + 4 <= n; ++round, i += 4) {
+      const __m256i v =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+      const __m256i lo = _mm256_and_si256(v, nibble);
+      const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+      bytes = _mm256_add_epi8(bytes, _mm256_shuffle_epi8(lookup, lo));
+      bytes = _mm256_add_epi8(bytes, _mm256_shuffle_epi8(lookup, hi));
+    }
+    total = _mm256_add_epi64(total, _mm256_sad_epu8(bytes, zero));
+  }
+  std::uint64_t lanes[4];
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), total);
+  std::size_t count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  for (; i < n; ++i) count += __builtin_popcountll(p[i]);
+  return count;
+}
+
+template <word_op Op>
+S21_TARGET_AVX2 void combine_avx2(std::uint64_t *dst, const std::uint64_t *src,
+                                  std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    auto *d = reinterpret_cast<__m256i *>(dst + i);
+    const __m256i a = _mm256_loadu_si256(d);
+    const __m256i b =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+    if constexpr (Op == word_op::and_)
+      _mm256_storeu_si256(d, _mm256_and_si256(a, b));
+    else if constexpr (Op == word_op::or_)
+      _mm256_storeu_si256(d, _mm256_or_si256(a, b));
+    else if constexpr (Op == word_op::xor_)
+      _mm256_storeu_si256(d, _mm256_xor_si256(a, b));
+    else
+      _mm256_storeu_si256(d, _mm256_andnot_si256(b, a));
+  }
+  combine_scalar<Op>(dst, src, i, n);
+}
+
+#pragma GCC diagnostic pop
+#endif  // S21_SIMD_X86
+
+/* Dispatchers working on a pointer and a length. */
+template <typename T>
+std::size_t find(const T *p, std::size_t n, const T &value) {
+#ifdef S21_SIMD_X86
+  if constexpr (vectorizable<T>) {
+    if (has_avx2()) return find_avx2(p, n, value);
+    return find_kernel<sse2<T>>(p, n, value);
+  }
+#endif
+  return std::find(p, p + n, value) - p;
+}
+
+template <typename T>
+std::size_t count(const T *p, std::size_t n, const T &value) {
+#ifdef S21_SIMD_X86
+  if constexpr (vectorizable<T>) {
+    if (has_avx2()) return count_avx2(p, n, value);
+    return count_kernel<sse2<T>>(p, n, value);
+  }
+#endif
+  return std::count(p, p + n, value);
+}
+
+template <bool IsMax, typename T>
+std::size_t extreme(const T *p, std::size_t n) {
+#ifdef S21_SIMD_X86
+  if constexpr (vectorizable<T>) {
+    std::size_t i = n;
+    if (n >= avx2<T>::lanes && has_avx2())
+      i = extreme_avx2<IsMax>(p, n);
+    else if (n >= sse2<T>::lanes)
+      i = extreme_kernel<sse2<T>, IsMax>(p, n);
+    if (i != n) return i;
+  }
+#endif
+  if constexpr (IsMax)
+    return std::max_element(p, p + n) - p;
+  else
+    return std::min_element(p, p + n) - p;
+}
+
+template <typename T>
+T sum(const T *p, std::size_t n, T init) {
+#ifdef S21_SIMD_X86
+  if constexpr (vectorizable<T>) {
+    if (has_avx2()) return sum_avx2(p, n, init);
+    return sum_kernel<sse2<T>>(p, n, init);
+  }
+#endif
+  return std::accumulate(p, p + n, init);
+}
+
+// number of set bits in n words
+inline std::size_t popcount(const std::uint64_t *p, std::size_t n) {
+#ifdef S21_SIMD_X86
+  if (has_avx2()) return popcount_avx2(p, n);
+  if (has_popcnt()) return popcount_popcnt(p, n);
+#endif
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; ++i) count += __builtin_popcountll(p[i]);
+  return count;
+}
+
+// dst[i] = dst[i] Op src[i] for n words
+template <word_op Op>
+void combine(std::uint64_t *dst, const std::uint64_t *src, std::size_t n) {
+#ifdef S21_SIMD_X86
+  if (has_avx2()) return combine_avx2<Op>(dst, src, n);
+#endif
+  combine_scalar<Op>(dst, src, 0, n);
+}
+
+}  // namespace detail
+
+/* Algorithms over s21::vector and s21::array. Iterators returned have the
+ * constness of the container, end() means not found / empty. */
+
+// first element equal to value
+template <typename C, typename = detail::enable_contiguous<C>>
+auto find(C &c, const typename C::value_type &value) -> decltype(c.begin()) {
+  return c.begin() + detail::find(c.data(), c.size(), value);
+}
+
+// number of elements equal to value
+template <typename C, typename = detail::enable_contiguous<C>>
+std::size_t count(const C &c, const typename C::value_type &value) {
+  return detail::count(c.data(), c.size(), value);
+}
+
+// checks whether the container holds value
+template <typename C, typename = detail::enable_contiguous<C>>
+bool contains(const C &c, const typename C::value_type &value) {
+  return detail::find(c.data(), c.size(), value) != c.size();
+}
+
+// first smallest element
+template <typename C, typename = detail::enable_contiguous<C>>
+auto min_element(C &c) -> decltype(c.begin()) {
+  return c.begin() + detail::extreme<false>(c.data(), c.size());
+}
+
+// first largest element
+template <typename C, typename = detail::enable_contiguous<C>>
+auto max_element(C &c) -> decltype(c.begin()) {
+  return c.begin() + detail::extreme<true>(c.data(), c.size());
+}
+
+// init plus the sum of all elements
+template <typename C, typename = detail::enable_contiguous<C>>
+typename C::value_type accumulate(
+    const C &c,
+    typename C::value_type init = typename C::value_type{}) {
+  return detail::sum(c.data(), c.size(), init);
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // S21_SIMD_H
@@ -0,0 +1,406 @@
+#ifndef S21_SOA_VECTOR_H
+#define S21_SOA_VECTOR_H
+#pragma once
+#include <tuple>
+
+#include "s21_span.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+template <typename Owner, bool is_const>
+class SoaIterator_base;
+
+/*
+ * Structure-of-arrays vector: element i is the tuple (c0[i], c1[i], ...) of
+ * one contiguous column per field. All columns share size, capacity and the
+ * Growth policy of s21::vector, so a loop touching one field streams through
+ * that field only. Elements are accessed as tuples of references.
+ */
+template <typename Growth, typename... Ts>
+class basic_soa_vector : public s21_sequence_container {
+  static_assert(sizeof...(Ts) > 0, "soa_vector: at least one column");
+  using columns_type = std::tuple<Ts *...>;
+  using indices = std::index_sequence_for<Ts...>;
+
+ public:
+  using value_type = std::tuple<Ts...>;
+  using reference = std::tuple<Ts &...>;
+  using const_reference = std::tuple<const Ts &...>;
+  using size_type = std::size_t;
+  using iterator = SoaIterator_base<basic_soa_vector, false>;
+  using const_iterator = SoaIterator_base<basic_soa_vector, true>;
+  template <std::size_t I>
+  using column_type = std::tuple_element_t<I, value_type>;
+
+ private:
+  columns_type columns_{};
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+  Growth growth_;
+
+ public:
+  /* Member functions */
+  basic_soa_vector() noexcept = default;
+
+  basic_soa_vector(std::initializer_list<value_type> const &items) {
+    reserve(items.size());
+    for (const auto &item : items) push_back(item);
+  }
+
+  basic_soa_vector(const basic_soa_vector &other) : growth_(other.growth_) {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) push_back(other[i]);
+  }
+
+  basic_soa_vector(basic_soa_vector &&other) noexcept { swap(other); }
+
+  ~basic_soa_vector() {
+    clear();
+    deallocate(columns_, capacity_, indices{});
+  }
+
+  basic_soa_vector &operator=(const basic_soa_vector &other) {
+    if (this != &other) {
+      basic_soa_vector copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  basic_soa_vector &operator=(basic_soa_vector &&other) noexcept {
+    if (this != &other) swap(other);
+    return *this;
+  }
+
+  /* Element access */
+  reference operator[](size_type i) noexcept { return row(i, indices{}); }
+  const_reference operator[](size_type i) const noexcept {
+    return row(i, indices{});
+  }
+
+  reference at(size_type i) {
+    if (i >= size_) throw std::out_of_range("soa_vector: out of range");
+    return (*this)[i];
+  }
+  const_reference at(size_type i) const {
+    if (i >= size_) throw std::out_of_range("soa_vector: out of range");
+    return (*this)[i];
+  }
+
+  reference front() {
+    if (empty()) throw std::out_of_range("soa_vector: vector is empty");
+    return (*this)[0];
+  }
+  reference back() {
+    if (empty()) throw std::out_of_range("soa_vector: vector is empty");
+    return (*this)[size_ - 1];
+  }
+
+  // field I of element i
+  template <std::size_t I>
+  column_type<I> &get(size_type i) noexcept {
+    return std::get<I>(columns_)[i];
+  }
+  template <std::size_t I>
+  const column_type<I> &get(size_type i) const noexcept {
+    return std::get<I>(columns_)[i];
+  }
+
+  // the contiguous column of field I
+  template <std::size_t I>
+  column_type<I> *data() noexcept {
+    return std::get<I>(columns_);
+  }
+  template <std::size_t I>
+  const column_type<I> *data() const noexcept {
+    return std::get<I>(columns_);
+  }
+  template <std::size_t I>
+  span<column_type<I>> column() noexcept {
+    return {std::get<I>(columns_), size_};
+  }
+  template <std::size_t I>
+  span<const column_type<I>> column() const noexcept {
+    return {std::get<I>(columns_), size_};
+  }
+
+  /* Iterators */
+  iterator begin() noexcept { return iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  /* Capacity */
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept {
+    return static_cast<size_type>(-1) / (sizeof(Ts) + ...);
+  }
+
+  void reserve(size_type n) {
+    if (n > max_size())
+      throw std::length_error("soa_vector: vector is too big");
+    if (n > capacity_) relocate(n);
+  }
+
+  void shrink_to_fit() {
+    if (capacity_ != size_) relocate(size_);
+  }
+
+  const Growth &growth_policy() const noexcept { return growth_; }
+  void set_growth_policy(const Growth &policy) { growth_ = policy; }
+
+  /* Modifiers */
+  void clear() noexcept {
+    destroy_rows(0, indices{});
+    size_ = 0;
+  }
+
+  void push_back(const value_type &value) {
+    std::apply([this](const Ts &...fields) { emplace_back(fields...); },
+               value);
+  }
+
+  void push_back(value_type &&value) {
+    std::apply(
+        [this](Ts &...fields) { emplace_back(std::move(fields)...); }, value);
+  }
+
+  // appends an element built from one argument per column
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    static_assert(sizeof...(Args) == sizeof...(Ts),
+                  "soa_vector: one argument per column");
+    if (size_ == capacity_) {
+      // the arguments may refer to our own fields, build them first
+      value_type tmp(std::forward<Args>(args)...);
+      relocate(advanceCapacity(size_ + 1));
+      construct_row(size_, std::move(tmp), indices{});
+    } else {
+      construct_row(size_, std::forward_as_tuple(std::forward<Args>(args)...),
+                    indices{});
+    }
+    return (*this)[size_++];
+  }
+
+  void pop_back() {
+    if (empty()) throw std::out_of_range("soa_vector: vector is empty");
+    destroy_rows(size_ - 1, indices{});
+    --size_;
+  }
+
+  void swap(basic_soa_vector &other) noexcept {
+    std::swap(columns_, other.columns_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(growth_, other.growth_);
+  }
+
+ private:
+  size_type advanceCapacity(size_type n) const {
+    const size_type cap = growth_(n);
+    return cap < n ? n : cap;
+  }
+
+  template <std::size_t... I>
+  reference row(size_type i, std::index_sequence<I...>) noexcept {
+    return reference(std::get<I>(columns_)[i]...);
+  }
+  template <std::size_t... I>
+  const_reference row(size_type i, std::index_sequence<I...>) const noexcept {
+    return const_reference(std::get<I>(columns_)[i]...);
+  }
+
+  // constructs the fields of row i from a tuple, all or nothing
+  template <typename Tuple, std::size_t... I>
+  void construct_row(size_type i, Tuple &&fields, std::index_sequence<I...>) {
+    std::size_t built = 0;
+    try {
+      ((::new (static_cast<void *>(std::get<I>(columns_) + i)) Ts(
+            std::get<I>(std::forward<Tuple>(fields))),
+        ++built),
+       ...);
+    } catch (...) {
+      ((I < built ? std::destroy_at(std::get<I>(columns_) + i) : void()), ...);
+      throw;
+    }
+  }
+
+  template <std::size_t... I>
+  void destroy_rows(size_type from, std::index_sequence<I...>) noexcept {
+    (std::destroy(std::get<I>(columns_) + from, std::get<I>(columns_) + size_),
+     ...);
+  }
+
+  template <std::size_t... I>
+  static void deallocate(columns_type &columns, size_type n,
+                         std::index_sequence<I...>) noexcept {
+    ((std::get<I>(columns) != nullptr
+          ? std::allocator<Ts>().deallocate(std::get<I>(columns), n)
+          : void()),
+     ...);
+  }
+
+  // moves every column into a buffer of new_cap elements; the old buffers
+  // are kept until every column has been transferred, so a throwing copy
+  // leaves the container as it was
+  void relocate(size_type new_cap) {
+    columns_type fresh{};
+    try {
+      allocate(fresh, new_cap, indices{});
+      move_columns(fresh, indices{});
+    } catch (...) {
+      deallocate(fresh, new_cap, indices{});
+      throw;
+    }
+    destroy_rows(0, indices{});
+    deallocate(columns_, capacity_, indices{});
+    columns_ = fresh;
+    capacity_ = new_cap;
+  }
+
+  template <std::size_t... I>
+  static void allocate(columns_type &columns, size_type n,
+                       std::index_sequence<I...>) {
+    if (n == 0) return;
+    ((std::get<I>(columns) = std::allocator<Ts>().allocate(n)), ...);
+  }
+
+  // Columns whose move constructor may throw are copied, like
+  // std::move_if_noexcept, and before any other column is moved: if one
+  // throws, the old rows are still intact.
+  template <std::size_t... I>
+  void move_columns(columns_type &fresh, std::index_sequence<I...>) {
+    bool copied[sizeof...(I)] = {};
+    try {
+      ((copied[I] = copy_column<I>(fresh)), ...);
+    } catch (...) {
+      ((copied[I] ? std::destroy(std::get<I>(fresh),
+                                 std::get<I>(fresh) + size_)
+                  : void()),
+       ...);
+      throw;
+    }
+    (move_column<I>(fresh), ...);
+  }
+
+  template <std::size_t I>
+  static constexpr bool copies_column =
+      !std::is_nothrow_move_constructible_v<column_type<I>> &&
+      std::is_copy_constructible_v<column_type<I>>;
+
+  // false when the column is left to move_column
+  template <std::size_t I>
+  bool copy_column(columns_type &fresh) {
+    if constexpr (copies_column<I>) {
+      std::uninitialized_copy(std::get<I>(columns_),
+                              std::get<I>(columns_) + size_,
+                              std::get<I>(fresh));
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+  template <std::size_t I>
+  void move_column(columns_type &fresh) {
+    if constexpr (!copies_column<I>)
+      std::uninitialized_move(std::get<I>(columns_),
+                              std::get<I>(columns_) + size_,
+                              std::get<I>(fresh));
+  }
+
+  friend class SoaIterator_base<basic_soa_vector, false>;
+  friend class SoaIterator_base<basic_soa_vector, true>;
+};
+
+template <typename... Ts>
+using soa_vector = basic_soa_vector<grow_double, Ts...>;
+
+// Random access iterator over soa_vector rows; dereferencing yields a tuple
+// of references into the columns.
+template <typename Owner, bool is_const>
+class SoaIterator_base {
+ public:
+  using owner_type = std::conditional_t<is_const, const Owner, Owner>;
+  using value_type = typename Owner::value_type;
+  using reference =
+      std::conditional_t<is_const, typename Owner::const_reference,
+                         typename Owner::reference>;
+  using pointer = void;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+
+  SoaIterator_base(owner_type *owner, std::size_t index) noexcept
+      : owner_(owner), index_(index) {}
+  // iterator -> const_iterator conversion
+  template <bool c = is_const, typename = std::enable_if_t<c>>
+  SoaIterator_base(const SoaIterator_base<Owner, false> &other) noexcept
+      : owner_(other.owner()), index_(other.index()) {}
+
+  reference operator*() const { return (*owner_)[index_]; }
+  reference operator[](difference_type n) const {
+    return (*owner_)[index_ + n];
+  }
+
+  SoaIterator_base &operator++() noexcept {
+    ++index_;
+    return *this;
+  }
+  SoaIterator_base operator++(int) noexcept {
+    return SoaIterator_base(owner_, index_++);
+  }
+  SoaIterator_base &operator--() noexcept {
+    --index_;
+    return *this;
+  }
+  SoaIterator_base operator--(int) noexcept {
+    return SoaIterator_base(owner_, index_--);
+  }
+  SoaIterator_base &operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+  }
+  SoaIterator_base &operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+  }
+  SoaIterator_base operator+(difference_type n) const noexcept {
+    return SoaIterator_base(owner_, index_ + n);
+  }
+  SoaIterator_base operator-(difference_type n) const noexcept {
+    return SoaIterator_base(owner_, index_ - n);
+  }
+  difference_type operator-(const SoaIterator_base &other) const noexcept {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  bool operator==(const SoaIterator_base &other) const noexcept {
+    return index_ == other.index_ && owner_ == other.owner_;
+  }
+  bool operator!=(const SoaIterator_base &other) const noexcept {
+    return !(*this == other);
+  }
+  bool operator<(const SoaIterator_base &other) const noexcept {
+    return index_ < other.index_;
+  }
+  bool operator>(const SoaIterator_base &other) const noexcept {
+    return other < *this;
+  }
+
+  owner_type *owner() const noexcept { return owner_; }
+  std::size_t index() const noexcept { return index_; }
+
+ private:
+  owner_type *owner_;
+  std::size_t index_;
+};
+
+}  // namespace s21
+
+#endif  // S21_SOA_VECTOR_H
@@ -0,0 +1,351 @@
+#ifndef S21_SPAN_H
+#define S21_SPAN_H
+#pragma once
+#include <stdexcept>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+inline constexpr std::size_t dynamic_extent = static_cast<std::size_t>(-1);
+
+template <typename T, std::size_t Extent = dynamic_extent>
+class span;
+template <typename T>
+class strided_span;
+
+namespace span_detail {
+
+template <typename C>
+struct is_span : std::false_type {};
+template <typename T, std::size_t E>
+struct is_span<span<T, E>> : std::true_type {};
+
+// C has data() and size(), and its elements can be seen as T
+template <typename C, typename T, typename = void>
+struct is_compatible_container : std::false_type {};
+template <typename C, typename T>
+struct is_compatible_container<
+    C, T,
+    std::void_t<decltype(std::declval<C &>().data()),
+                decltype(std::declval<C &>().size())>>
+    : std::bool_constant<
+          !is_span<std::remove_cv_t<C>>::value &&
+          std::is_convertible_v<std::remove_pointer_t<decltype(
+                                    std::declval<C &>().data())> (*)[],
+                                T (*)[]>> {};
+
+}  // namespace span_detail
+
+/*
+ * Non-owning view of count contiguous elements: a pointer and a size,
+ * cheap to copy and pass by value between functions instead of copying
+ * sub-ranges into new vectors. A span never outlives the storage it looks
+ * at and is invalidated with the iterators of that container. Extent fixes
+ * the size at compile time; the default dynamic_extent keeps it at runtime.
+ * Iterators are the VectorIterator_base of s21::vector.
+ */
+template <typename T, std::size_t Extent>
+class span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+  using iterator = VectorIterator_base<value_type, std::is_const_v<T>>;
+
+  static constexpr size_type extent = Extent;
+
+ private:
+  pointer data_ = nullptr;
+  size_type size_ = 0;
+
+  static constexpr size_type checked_size(size_type n) {
+    if (Extent != dynamic_extent && n != Extent)
+      throw std::out_of_range("span: size does not match the extent");
+    return n;
+  }
+
+ public:
+  /* Member functions */
+  template <std::size_t E = Extent,
+            typename = std::enable_if_t<E == 0 || E == dynamic_extent>>
+  constexpr span() noexcept {}
+
+  constexpr span(pointer first, size_type count)
+      : data_(first), size_(checked_size(count)) {}
+
+  constexpr span(pointer first, pointer last)
+      : span(first, static_cast<size_type>(last - first)) {}
+
+  template <std::size_t N, typename = std::enable_if_t<
+                               Extent == dynamic_extent || N == Extent>>
+  constexpr span(element_type (&arr)[N]) noexcept : data_(arr), size_(N) {}
+
+  // s21::vector, s21::array or any container with contiguous data() and
+  // size()
+  template <typename C, typename = std::enable_if_t<
+                            span_detail::is_compatible_container<C, T>::value>>
+  constexpr span(C &c) : span(c.data(), static_cast<size_type>(c.size())) {}
+
+  // span<U> -> span<const U>, dynamic -> static extent after a size check
+  template <typename U, std::size_t E,
+            typename = std::enable_if_t<
+                std::is_convertible_v<U (*)[], T (*)[]> &&
+                (Extent == dynamic_extent || E == dynamic_extent ||
+                 E == Extent)>>
+  constexpr span(const span<U, E> &other)
+      : data_(other.data()), size_(checked_size(other.size())) {}
+
+  constexpr span(const span &) noexcept = default;
+  constexpr span &operator=(const span &) noexcept = default;
+
+  /* Element access */
+  constexpr reference operator[](size_type i) const noexcept {
+    return data_[i];
+  }
+  constexpr reference at(size_type i) const {
+    if (i >= size_) throw std::out_of_range("span: out of range");
+    return data_[i];
+  }
+  constexpr reference front() const {
+    if (empty()) throw std::out_of_range("span: span is empty");
+    return data_[0];
+  }
+  constexpr reference back() const {
+    if (empty()) throw std::out_of_range("span: span is empty");
+    return data_[size_ - 1];
+  }
+  constexpr pointer data() const noexcept { return data_; }
+
+  /* Iterators */
+  iterator begin() const noexcept { return iterator(data_); }
+  iterator end() const noexcept { return iterator(data_ + size_); }
+
+  /* Capacity */
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr size_type size_bytes() const noexcept {
+    return size_ * sizeof(T);
+  }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  /* Subviews */
+  // the first Count elements
+  template <std::size_t Count>
+  constexpr span<T, Count> first() const {
+    return span<T, Count>(data_, checked_count(0, Count));
+  }
+  constexpr span<T> first(size_type count) const {
+    return span<T>(data_, checked_count(0, count));
+  }
+
+  // the last Count elements
+  template <std::size_t Count>
+  constexpr span<T, Count> last() const {
+    return span<T, Count>(data_ + size_ - checked_count(0, Count), Count);
+  }
+  constexpr span<T> last(size_type count) const {
+    return span<T>(data_ + size_ - checked_count(0, count), count);
+  }
+
+  // count elements from offset, up to the end by default
+  template <std::size_t Offset, std::size_t Count = dynamic_extent>
+  constexpr auto subspan() const {
+    constexpr std::size_t E =
+        Count != dynamic_extent
+            ? Count
+            : (Extent != dynamic_extent ? Extent - Offset : dynamic_extent);
+    check_range(Offset, Count == dynamic_extent ? 0 : Count);
+    return span<T, E>(data_ + Offset,
+                      Count == dynamic_extent ? size_ - Offset : Count);
+  }
+  constexpr span<T> subspan(size_type offset,
+                            size_type count = dynamic_extent) const {
+    if (count == dynamic_extent) {
+      check_range(offset, 0);
+      count = size_ - offset;
+    }
+    check_range(offset, count);
+    return span<T>(data_ + offset, count);
+  }
+
+  // every step-th element, starting with the first
+  strided_span<T> stride(size_type step) const {
+    return strided_span<T>(*this, step);
+  }
+
+ private:
+  constexpr size_type checked_count(size_type offset, size_type count) const {
+    check_range(offset, count);
+    return count;
+  }
+  constexpr void check_range(size_type offset, size_type count) const {
+    if (offset > size_ || count > size_ - offset)
+      throw std::out_of_range("span: subspan out of range");
+  }
+};
+
+template <typename T, std::size_t N>
+span(T (&)[N]) -> span<T, N>;
+template <typename C>
+span(C &) -> span<std::remove_pointer_t<decltype(std::declval<C &>().data())>>;
+
+// Keeps the first element and an index: the element address is formed only
+// on dereference, so end() of a view with a stride above one, or a negative
+// one, never points outside the underlying array.
+template <typename T, bool is_const = false>
+class StridedIterator_base {
+ public:
+  using pointer = std::conditional_t<is_const, const T *, T *>;
+  using reference = std::conditional_t<is_const, const T &, T &>;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+
+ private:
+  pointer base_;
+  difference_type index_;
+  difference_type stride_;
+
+ public:
+  StridedIterator_base(pointer base, difference_type index,
+                       difference_type stride) noexcept
+      : base_(base), index_(index), stride_(stride) {}
+
+  reference operator*() const noexcept { return base_[index_ * stride_]; }
+  pointer operator->() const noexcept { return &**this; }
+  reference operator[](difference_type n) const noexcept {
+    return base_[(index_ + n) * stride_];
+  }
+
+  StridedIterator_base &operator++() noexcept {
+    ++index_;
+    return *this;
+  }
+  StridedIterator_base operator++(int) noexcept {
+    StridedIterator_base tmp = *this;
+    ++*this;
+    return tmp;
+  }
+  StridedIterator_base &operator--() noexcept {
+    --index_;
+    return *this;
+  }
+  StridedIterator_base operator--(int) noexcept {
+    StridedIterator_base tmp = *this;
+    --*this;
+    return tmp;
+  }
+  StridedIterator_base &operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+  }
+  StridedIterator_base &operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+  }
+  StridedIterator_base operator+(difference_type n) const noexcept {
+    return StridedIterator_base(base_, index_ + n, stride_);
+  }
+  StridedIterator_base operator-(difference_type n) const noexcept {
+    return StridedIterator_base(base_, index_ - n, stride_);
+  }
+  difference_type operator-(const StridedIterator_base &other) const noexcept {
+    return index_ - other.index_;
+  }
+
+  bool operator==(const StridedIterator_base &other) const noexcept {
+    return index_ == other.index_;
+  }
+  bool operator!=(const StridedIterator_base &other) const noexcept {
+    return !(*this == other);
+  }
+  bool operator<(const StridedIterator_base &other) const noexcept {
+    return index_ < other.index_;
+  }
+  bool operator>(const StridedIterator_base &other) const noexcept {
+    return other < *this;
+  }
+};
+
+/*
+ * Non-owning view of size elements stride elements apart, e.g. a column of
+ * a row-major matrix: strided_span<double>(m.data() + col, rows, cols).
+ * A negative stride walks backwards from the first element.
+ */
+template <typename T>
+class strided_span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+  using iterator = StridedIterator_base<value_type, std::is_const_v<T>>;
+
+ private:
+  pointer data_ = nullptr;
+  size_type size_ = 0;
+  difference_type stride_ = 1;
+
+ public:
+  /* Member functions */
+  constexpr strided_span() noexcept = default;
+
+  constexpr strided_span(pointer first, size_type count,
+                         difference_type stride)
+      : data_(first), size_(count), stride_(stride) {
+    if (stride == 0) throw std::invalid_argument("strided_span: zero stride");
+  }
+
+  // every step-th element of s, starting with its first
+  template <typename U, std::size_t E,
+            typename = std::enable_if_t<std::is_convertible_v<U (*)[],
+                                                              T (*)[]>>>
+  strided_span(const span<U, E> &s, size_type step)
+      : strided_span(s.data(),
+                     step ? (s.size() + step - 1) / step : s.size(),
+                     static_cast<difference_type>(step)) {}
+
+  /* Element access */
+  constexpr reference operator[](size_type i) const noexcept {
+    return data_[static_cast<difference_type>(i) * stride_];
+  }
+  constexpr reference at(size_type i) const {
+    if (i >= size_) throw std::out_of_range("strided_span: out of range");
+    return (*this)[i];
+  }
+  constexpr pointer data() const noexcept { return data_; }
+  constexpr difference_type stride() const noexcept { return stride_; }
+
+  /* Iterators */
+  iterator begin() const noexcept { return iterator(data_, 0, stride_); }
+  iterator end() const noexcept {
+    return iterator(data_, static_cast<difference_type>(size_), stride_);
+  }
+
+  /* Capacity */
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  /* Subviews */
+  strided_span subspan(size_type offset,
+                       size_type count = dynamic_extent) const {
+    if (offset > size_)
+      throw std::out_of_range("strided_span: subspan out of range");
+    if (count == dynamic_extent) count = size_ - offset;
+    if (count > size_ - offset)
+      throw std::out_of_range("strided_span: subspan out of range");
+    // an empty tail keeps data_ rather than stepping past the array
+    if (count == 0) return strided_span(data_, 0, stride_);
+    return strided_span(data_ + static_cast<difference_type>(offset) * stride_,
+                        count, stride_);
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_SPAN_H
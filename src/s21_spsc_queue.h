@@ -0,0 +1,178 @@
+#ifndef S21_SPSC_QUEUE_H
+#define S21_SPSC_QUEUE_H
+#pragma once
+#include <atomic>
+#include <stdexcept>
+
+#include "s21_containers_common.h"
+
+namespace s21 {
+
+/*
+ * Bounded wait-free queue for exactly one producer thread and one consumer
+ * thread. Elements live in a ring of power-of-two slots indexed by two
+ * ever-growing counters: the producer owns tail_, the consumer owns head_,
+ * and each side publishes its counter with a release store that the other
+ * side reads with acquire. The counters sit on separate cache lines, and
+ * each side keeps a plain copy of the other's counter that it refreshes
+ * only when the queue looks full (producer) or empty (consumer), so in the
+ * steady state neither side touches the other's line. Only the producer
+ * may call try_push/try_emplace/push_bulk and only the consumer
+ * try_pop/front/pop/pop_bulk; size() and empty() are approximate while
+ * both run.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class spsc_queue {
+  using a_traits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+ private:
+  // read-only after construction, shared by both sides
+  Allocator alloc_;
+  T *data_ = nullptr;
+  size_type slots_ = 0;
+  size_type capacity_ = 0;
+
+  // producer line: its counter and its copy of head_
+  alignas(cache_line_size) std::atomic<size_type> tail_{0};
+  size_type head_cache_ = 0;
+
+  // consumer line: its counter and its copy of tail_
+  alignas(cache_line_size) std::atomic<size_type> head_{0};
+  size_type tail_cache_ = 0;
+
+ public:
+  /* Member functions */
+  // queue holding at most capacity elements
+  explicit spsc_queue(size_type capacity, const Allocator &alloc = Allocator())
+      : alloc_(alloc), capacity_(capacity) {
+    if (capacity == 0) throw std::length_error("spsc_queue: zero capacity");
+    if (capacity > a_traits::max_size(alloc_) / 2)
+      throw std::length_error("spsc_queue: too big");
+    slots_ = 1;
+    while (slots_ < capacity) slots_ *= 2;
+    data_ = a_traits::allocate(alloc_, slots_);
+  }
+
+  // threads hold references to the queue, it never moves
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+
+  ~spsc_queue() {
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i)
+      a_traits::destroy(alloc_, slot(i));
+    a_traits::deallocate(alloc_, data_, slots_);
+  }
+
+  /* Capacity */
+  size_type capacity() const noexcept { return capacity_; }
+  size_type size() const noexcept {
+    // head first: tail only grows, so the difference never goes negative
+    const size_type head = head_.load(std::memory_order_acquire);
+    return tail_.load(std::memory_order_acquire) - head;
+  }
+  bool empty() const noexcept { return size() == 0; }
+
+  /* Producer */
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  // constructs an element in place, false when the queue is full
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ == capacity_) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      if (tail - head_cache_ == capacity_) return false;
+    }
+    a_traits::construct(alloc_, slot(tail), std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Copies up to n elements from first (wrap it in std::make_move_iterator
+  // to move them) with a single publication, returns how many fit. If a
+  // copy throws, the elements before it are still pushed.
+  template <typename InputIt>
+  size_type push_bulk(InputIt first, size_type n) {
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+    if (capacity_ - (tail - head_cache_) < n)
+      head_cache_ = head_.load(std::memory_order_acquire);
+    const size_type room = capacity_ - (tail - head_cache_);
+    if (n > room) n = room;
+    size_type done = 0;
+    try {
+      for (; done < n; ++done, ++first)
+        a_traits::construct(alloc_, slot(tail + done), *first);
+    } catch (...) {
+      tail_.store(tail + done, std::memory_order_release);
+      throw;
+    }
+    tail_.store(tail + done, std::memory_order_release);
+    return done;
+  }
+
+  /* Consumer */
+  // moves the oldest element into out, false when the queue is empty
+  bool try_pop(reference out) {
+    T *item = front();
+    if (item == nullptr) return false;
+    out = std::move(*item);
+    pop();
+    return true;
+  }
+
+  // oldest element or nullptr when the queue is empty; stays valid until
+  // pop()
+  T *front() noexcept {
+    const size_type head = head_.load(std::memory_order_relaxed);
+    if (head == tail_cache_) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+      if (head == tail_cache_) return nullptr;
+    }
+    return slot(head);
+  }
+
+  // drops the element returned by front(), which must not be nullptr
+  void pop() noexcept {
+    const size_type head = head_.load(std::memory_order_relaxed);
+    a_traits::destroy(alloc_, slot(head));
+    head_.store(head + 1, std::memory_order_release);
+  }
+
+  // Moves up to max elements to out with a single publication, returns how
+  // many. If an assignment throws, its element stays in the queue.
+  template <typename OutputIt>
+  size_type pop_bulk(OutputIt out, size_type max) {
+    const size_type head = head_.load(std::memory_order_relaxed);
+    if (tail_cache_ - head < max)
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+    const size_type n = tail_cache_ - head < max ? tail_cache_ - head : max;
+    size_type done = 0;
+    try {
+      for (; done < n; ++done, ++out) {
+        *out = std::move(*slot(head + done));
+        a_traits::destroy(alloc_, slot(head + done));
+      }
+    } catch (...) {
+      head_.store(head + done, std::memory_order_release);
+      throw;
+    }
+    head_.store(head + done, std::memory_order_release);
+    return done;
+  }
+
+ private:
+  T *slot(size_type i) const noexcept { return data_ + (i & (slots_ - 1)); }
+};
+
+}  // namespace s21
+
+#endif  // S21_SPSC_QUEUE_H
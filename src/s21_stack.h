@@ -2,31 +2,31 @@
 #define _S21_STACK_H 1
 #pragma once
 #include "s21_containers_common.h"
+#include "s21_vector.h"
 
 namespace s21 {
 
-template <typename T>
-using StackNode = QueueNode<T>;
-
-template <typename T, bool is_const = false>
-using StackIterator_base = QueueIterator_base<T, is_const>;
-
-template <typename T>
-class stack : public s21_sequence_container {
+// LIFO adapter, the top is the back of the container. Container needs
+// push_back/emplace_back, pop_back, back, size and iterators: the default
+// s21::vector keeps the elements in one block and push is an amortized
+// O(1) append without a node allocation, while s21::list, s21::deque or
+// s21::unrolled_list can be plugged in instead. Iterators run from the
+// bottom to the top.
+template <typename T, typename Container = vector<T>>
+class stack : public s21_container_adapter {
  public:
+  using container_type = Container;
   using value_type = T;   // the template parameter T
   using reference = T &;  // defines the type of the reference to an element
   using const_reference =
       const T &;             // defines the type of the constant reference
   using size_type = size_t;  // defines the type of the container size (standard
                              // type is size_t)
-  using iterator = StackIterator_base<T, false>;
-  using const_iterator = StackIterator_base<T, true>;
-  using node_type = StackNode<T>;
+  using iterator = typename Container::iterator;
+  using const_iterator = typename Container::const_iterator;
 
- private:
-  size_type size_ = 0;
-  node_type *front_ = nullptr;
+ protected:
+  Container c;
 
  public:
   // default constructor, creates empty stack
@@ -40,90 +40,92 @@ class stack : public s21_sequence_container {
     }
   }
 
-  // copy constructor
-  stack(const stack &s) : stack() { *this = s; };
-  // move constructor
-  stack(stack &&s) : stack() { *this = std::forward<stack<T>>(s); };
+  // wraps an existing container, its back is the top of the stack
+  explicit stack(const Container &cont) : c(cont) {}
+  explicit stack(Container &&cont) : c(std::move(cont)) {}
 
-  // destructor
-  ~stack() {
-    while (!empty()) pop();
+  // builds the container from alloc, so several adapters can share one
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator_v<Container, Alloc>>>
+  explicit stack(const Alloc &alloc) : c(alloc) {}
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator_v<Container, Alloc>>>
+  stack(std::initializer_list<value_type> const &items, const Alloc &alloc)
+      : c(alloc) {
+    for (const auto &item : items) push(item);
   }
 
+  // copy constructor
+  stack(const stack &s) = default;
+  // move constructor
+  stack(stack &&s) noexcept : stack() { swap(s); };
+
   // assignment operator overload for copying object
-  stack &operator=(const stack &s) {
-    if (this != &s) {
-      while (size() > s.size()) {
-        pop();
-      }
-      iterator sit(s.front_);
-      iterator it_end(nullptr);
-      while (size() < s.size()) {
-        this->push(*sit);
-      }
-      iterator it(front_);
-      while (it != it_end && sit != it_end) {
-        *it = *sit;
-        ++it;
-        ++sit;
-      }
-    }
-    return *this;
-  }
+  stack &operator=(const stack &s) = default;
   // assignment operator overload for moving object
-  stack &operator=(stack &&s) {
+  stack &operator=(stack &&s) noexcept {
     swap(s);
     return *this;
   }
 
   /*Stack Element access*/
   // access the top element
-  const_reference top() {
+  reference top() {
+    if (empty()) throw std::out_of_range("stack: stack is empty");
+    return c.back();
+  }
+  const_reference top() const {
     if (empty()) throw std::out_of_range("stack: stack is empty");
-    return front_->getData();
+    return c.back();
   }
 
+  /*Stack Iterators, from the bottom to the top*/
+  iterator begin() noexcept { return c.begin(); }
+  iterator end() noexcept { return c.end(); }
+  const_iterator begin() const noexcept { return c.cbegin(); }
+  const_iterator end() const noexcept { return c.cend(); }
+
   /*Stack Capacity*/
   // checks whether the container is empty
-  bool empty() const { return (size() == 0); }
+  bool empty() const { return c.empty(); }
   // returns the number of elements
-  size_type size() const { return size_; }
+  size_type size() const { return c.size(); }
+  // returns the allocator of the underlying container
+  auto get_allocator() const { return c.get_allocator(); }
 
   /*Stack Modifiers*/
   // inserts an element at the top
-  void push(const_reference value) {
-    front_ = new node_type(value, front_);
-    size_++;
+  void push(const_reference value) { c.push_back(value); }
+  void push(value_type &&value) { c.push_back(std::move(value)); }
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    return c.emplace_back(std::forward<Args>(args)...);
   }
-  // removes the first element
+  // removes the top element
   void pop() {
     if (empty()) throw std::out_of_range("stack: stack is empty");
-    auto temp = front_;
-    front_ = front_->getNext();
-    delete temp;
-    --size_;
+    c.pop_back();
   }
   // swaps the contents
-  void swap(stack &other) {
-    std::swap(front_, other.front_);
-    std::swap(size_, other.size_);
-  }
+  void swap(stack &other) noexcept { c.swap(other.c); }
 
+  // Slides args under the bottom of the stack, the first one nearest to
+  // the elements already there and the last one at the very bottom: it
+  // is what gets popped last.
   template <class... Args>
   void insert_many_back(Args &&...args) {
-    auto last = front_;
-    while (size() && last->getNext() != nullptr) last = last->getNext();
-    for (auto &item : {args...}) {
-      node_type *new_node = new node_type(item);
-      if (last != nullptr)
-        new_node->splice_after(last);
-      else
-        front_ = new_node;
-      last = new_node;
-      ++size_;
-    }
+    (push_bottom(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  template <typename U>
+  void push_bottom(U &&value) {
+    if constexpr (has_push_front<Container>::value)
+      c.push_front(std::forward<U>(value));
+    else
+      c.insert(c.begin(), std::forward<U>(value));
   }
 };
 };  // namespace s21
 
-#endif  // S21_STACK_H
\ No newline at end of file
+#endif  // S21_STACK_H
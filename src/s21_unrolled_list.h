@@ -0,0 +1,512 @@
+#ifndef S21_UNROLLED_LIST_H
+#define S21_UNROLLED_LIST_H
+#pragma once
+#include <algorithm>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+
+#include "s21_containers_common.h"
+#include "s21_list.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Elements per unrolled_list chunk: 256 bytes worth, at least 8.
+template <typename T>
+constexpr std::size_t unrolled_chunk_size() noexcept {
+  return 256 / sizeof(T) < 8 ? 8 : 256 / sizeof(T);
+}
+
+// Node of an unrolled_list: up to B elements in place, the first count of
+// them constructed.
+template <typename T, std::size_t B>
+struct unrolled_chunk : listNode_base {
+  std::size_t count = 0;
+  alignas(T) unsigned char storage[B * sizeof(T)];
+
+  T *data() noexcept { return std::launder(reinterpret_cast<T *>(storage)); }
+};
+
+template <typename T, std::size_t B, bool is_const = false>
+class UnrolledIterator_base {
+ public:
+  using pointer = std::conditional_t<is_const, const T *, T *>;
+  using reference = std::conditional_t<is_const, const T &, T &>;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using chunk_type = unrolled_chunk<T, B>;
+
+ private:
+  listNode_base *node_;
+  std::size_t index_;
+
+ public:
+  UnrolledIterator_base(listNode_base *node, std::size_t index) noexcept
+      : node_(node), index_(index) {}
+  // iterator -> const_iterator conversion
+  template <bool c = is_const, typename = std::enable_if_t<c>>
+  UnrolledIterator_base(
+      const UnrolledIterator_base<T, B, false> &other) noexcept
+      : node_(other.node()), index_(other.index()) {}
+
+  reference operator*() const noexcept { return chunk()->data()[index_]; }
+  pointer operator->() const noexcept { return chunk()->data() + index_; }
+
+  UnrolledIterator_base &operator++() noexcept {
+    if (++index_ == chunk()->count) {
+      node_ = node_->getNext();
+      index_ = 0;
+    }
+    return *this;
+  }
+  UnrolledIterator_base operator++(int) noexcept {
+    UnrolledIterator_base tmp = *this;
+    ++*this;
+    return tmp;
+  }
+  UnrolledIterator_base &operator--() noexcept {
+    if (index_ == 0) {
+      node_ = node_->getPrev();
+      index_ = chunk()->count;
+    }
+    --index_;
+    return *this;
+  }
+  UnrolledIterator_base operator--(int) noexcept {
+    UnrolledIterator_base tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  bool operator==(const UnrolledIterator_base &other) const noexcept {
+    return node_ == other.node_ && index_ == other.index_;
+  }
+  bool operator!=(const UnrolledIterator_base &other) const noexcept {
+    return !(*this == other);
+  }
+
+  listNode_base *node() const noexcept { return node_; }
+  std::size_t index() const noexcept { return index_; }
+
+ private:
+  chunk_type *chunk() const noexcept {
+    return static_cast<chunk_type *>(node_);
+  }
+};
+
+/*
+ * Unrolled linked list: a ring of chunks hooked through listNode_base like
+ * s21::list's nodes, each holding up to B elements in place. Scans read B
+ * neighbouring elements per pointer chase and there is one allocation per
+ * chunk instead of per element. Inserting into a full chunk splits it in
+ * two halves, erasing merges a chunk with its successor once both fit in
+ * 3/4 of a chunk, so insert and erase at an iterator cost O(B) moves.
+ * Both invalidate the iterators into the chunks they touch; splice() and
+ * swap() move whole chunks and keep the elements in place.
+ */
+template <typename T, std::size_t B = unrolled_chunk_size<T>(),
+          typename Allocator = std::allocator<T>>
+class unrolled_list {
+  static_assert(B >= 2, "unrolled_list: a chunk holds at least 2 elements");
+
+  using chunk_type = unrolled_chunk<T, B>;
+  using a_traits = std::allocator_traits<Allocator>;
+  using chunk_allocator = typename a_traits::template rebind_alloc<chunk_type>;
+  using c_traits = std::allocator_traits<chunk_allocator>;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = UnrolledIterator_base<T, B, false>;
+  using const_iterator = UnrolledIterator_base<T, B, true>;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  static constexpr size_type chunk_size = B;
+
+ private:
+  listNode_base fake_node;
+  size_type size_ = 0;
+  Allocator alloc_;
+  chunk_allocator chunk_alloc_;
+
+ public:
+  /* Member functions */
+  unrolled_list() = default;
+  explicit unrolled_list(const Allocator &alloc)
+      : alloc_(alloc), chunk_alloc_(alloc) {}
+
+  unrolled_list(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) push_back(item);
+  }
+
+  unrolled_list(const unrolled_list &other)
+      : alloc_(a_traits::select_on_container_copy_construction(other.alloc_)),
+        chunk_alloc_(alloc_) {
+    for (const auto &item : other) push_back(item);
+  }
+
+  unrolled_list(unrolled_list &&other) noexcept { swap(other); }
+
+  ~unrolled_list() { clear(); }
+
+  unrolled_list &operator=(const unrolled_list &other) {
+    if (this != &other) {
+      unrolled_list copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  unrolled_list &operator=(unrolled_list &&other) noexcept {
+    if (this != &other) swap(other);
+    return *this;
+  }
+
+  /* Element access */
+  reference front() {
+    if (empty()) throw std::out_of_range("unrolled_list: list is empty");
+    return *begin();
+  }
+  const_reference front() const {
+    if (empty()) throw std::out_of_range("unrolled_list: list is empty");
+    return *begin();
+  }
+  reference back() {
+    if (empty()) throw std::out_of_range("unrolled_list: list is empty");
+    return *--end();
+  }
+  const_reference back() const {
+    if (empty()) throw std::out_of_range("unrolled_list: list is empty");
+    return *--end();
+  }
+
+  /* Iterators */
+  iterator begin() noexcept { return iterator(fake_node.getNext(), 0); }
+  iterator end() noexcept { return iterator(&fake_node, 0); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cbegin() const noexcept {
+    return const_iterator(fake_node.getNext(), 0);
+  }
+  const_iterator cend() const noexcept {
+    return const_iterator(const_cast<listNode_base *>(&fake_node), 0);
+  }
+
+  /* Capacity */
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(chunk_type);
+  }
+  // number of chunks in use
+  size_type chunk_count() const noexcept {
+    size_type n = 0;
+    for (const listNode_base *c = fake_node.getNext(); c != &fake_node;
+         c = c->getNext())
+      ++n;
+    return n;
+  }
+  Allocator get_allocator() const { return alloc_; }
+
+  /* Modifiers */
+  void clear() noexcept {
+    listNode_base *c = fake_node.getNext();
+    while (c != &fake_node) {
+      listNode_base *next = c->getNext();
+      destroy_chunk(as_chunk(c));
+      c = next;
+    }
+    listNode_base::link(&fake_node, &fake_node);
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  // constructs an element from args before pos
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    if (size_ >= max_size())
+      throw std::length_error("unrolled_list: list is too big");
+    listNode_base *node = pos.node();
+    size_type index = pos.index();
+    if (node == &fake_node) {
+      // appending: fill the last chunk, then start a new one
+      node = fake_node.getPrev();
+      if (node == &fake_node || as_chunk(node)->count == B)
+        node = new_chunk(&fake_node);
+      index = as_chunk(node)->count;
+    }
+    chunk_type *c = as_chunk(node);
+    if (index == c->count) {
+      a_traits::construct(alloc_, c->data() + index,
+                          std::forward<Args>(args)...);
+      ++c->count;
+      ++size_;
+      return iterator(c, index);
+    }
+    // args may refer to an element that is about to move
+    value_type value(std::forward<Args>(args)...);
+    if (c->count == B) {
+      if (index == 0) {
+        // in front of a full chunk: fill the previous one or start a new one
+        listNode_base *before = c->getPrev();
+        chunk_type *prev = before == &fake_node || as_chunk(before)->count == B
+                               ? new_chunk(c)
+                               : as_chunk(before);
+        a_traits::construct(alloc_, prev->data() + prev->count,
+                            std::move(value));
+        ++size_;
+        return iterator(prev, prev->count++);
+      }
+      chunk_type *half = split(c, B / 2);
+      if (index > B / 2) {
+        c = half;
+        index -= B / 2;
+      }
+      if (index == c->count) {
+        a_traits::construct(alloc_, c->data() + index, std::move(value));
+        ++c->count;
+        ++size_;
+        return iterator(c, index);
+      }
+    }
+    T *data = c->data();
+    a_traits::construct(alloc_, data + c->count, std::move(data[c->count - 1]));
+    ++c->count;
+    std::move_backward(data + index, data + c->count - 2,
+                       data + c->count - 1);
+    data[index] = std::move(value);
+    ++size_;
+    return iterator(c, index);
+  }
+
+  // erases the element at pos, returns the iterator to the next one
+  iterator erase(const_iterator pos) {
+    chunk_type *c = as_chunk(pos.node());
+    const size_type index = pos.index();
+    T *data = c->data();
+    std::move(data + index + 1, data + c->count, data + index);
+    a_traits::destroy(alloc_, data + c->count - 1);
+    --c->count;
+    --size_;
+    if (c->count == 0) {
+      listNode_base *next = c->getNext();
+      destroy_chunk(c);
+      return iterator(next, 0);
+    }
+    listNode_base *next = c->getNext();
+    if (next != &fake_node && (c->count + as_chunk(next)->count) * 4 <= B * 3)
+      absorb_next(c);
+    if (index == c->count) return iterator(c->getNext(), 0);
+    return iterator(c, index);
+  }
+
+  // erases [first, last), returns last
+  iterator erase(const_iterator first, const_iterator last) {
+    if (last == cend()) {
+      truncate(first);
+      return end();
+    }
+    // count first: erasing may move the elements last points at
+    size_type n = 0;
+    for (const_iterator it = first; it != last; ++it) ++n;
+    iterator it(first.node(), first.index());
+    while (n-- > 0) it = erase(it);
+    return it;
+  }
+
+  void push_back(const_reference value) { emplace(cend(), value); }
+  void push_back(value_type &&value) { emplace(cend(), std::move(value)); }
+  void push_front(const_reference value) { emplace(cbegin(), value); }
+  void push_front(value_type &&value) { emplace(cbegin(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplace(cend(), std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    return *emplace(cbegin(), std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    if (empty()) throw std::out_of_range("unrolled_list: list is empty");
+    erase(--cend());
+  }
+  void pop_front() {
+    if (empty()) throw std::out_of_range("unrolled_list: list is empty");
+    erase(cbegin());
+  }
+
+  void swap(unrolled_list &other) noexcept {
+    fake_node.swap(other.fake_node);
+    std::swap(size_, other.size_);
+    std::swap(alloc_, other.alloc_);
+    std::swap(chunk_alloc_, other.chunk_alloc_);
+  }
+
+  // Merges two lists sorted by comp in place; equal elements of *this come
+  // first. Elements of other that go in between are inserted, the tail
+  // that follows every element of *this is spliced over chunk by chunk
+  // when the allocators compare equal.
+  template <typename Compare>
+  void merge(unrolled_list &other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    iterator a = begin(), b = other.begin();
+    for (; a != end() && b != other.end(); ++a) {
+      if (comp(*b, *a)) a = emplace(a, std::move(*b++));
+    }
+    if (alloc_ == other.alloc_) {
+      other.erase(other.begin(), b);
+      splice(end(), other);
+    } else {
+      for (; b != other.end(); ++b) push_back(std::move(*b));
+      other.clear();
+    }
+  }
+  void merge(unrolled_list &other) { merge(other, std::less<>()); }
+
+  // moves all chunks of other before pos; a pos inside a chunk splits it
+  void splice(const_iterator pos, unrolled_list &other) {
+    if (this == &other || other.empty()) return;
+    listNode_base *at = pos.node();
+    if (pos.index() != 0) at = split(as_chunk(at), pos.index());
+    listNode_base *head = other.fake_node.getNext();
+    listNode_base *tail = other.fake_node.getPrev();
+    listNode_base::link(&other.fake_node, &other.fake_node);
+    listNode_base::link(at->getPrev(), head);
+    listNode_base::link(tail, at);
+    size_ += other.size_;
+    other.size_ = 0;
+  }
+
+  // reverses the order of the chunks and of the elements in each
+  void reverse() noexcept {
+    listNode_base *c = fake_node.getNext();
+    while (c != &fake_node) {
+      chunk_type *chunk = as_chunk(c);
+      std::reverse(chunk->data(), chunk->data() + chunk->count);
+      c = c->getNext();
+      chunk->swapNeighbors();
+    }
+    fake_node.swapNeighbors();
+  }
+
+  // removes consecutive equal elements
+  void unique() {
+    iterator last = std::unique(begin(), end());
+    truncate(last);
+  }
+
+  // stable sort through a contiguous buffer, the elements are moved twice
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) return;
+    vector<value_type> buffer;
+    buffer.reserve(size_);
+    for (auto &item : *this) buffer.push_back(std::move(item));
+    std::stable_sort(buffer.begin(), buffer.end(), comp);
+    auto from = buffer.begin();
+    for (auto &item : *this) item = std::move(*from++);
+  }
+  void sort() { sort(std::less<>()); }
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    // an insertion may split the chunk pos points into, so every element
+    // goes after the previous one rather than before the original pos
+    iterator it(pos.node(), pos.index());
+    ((it = ++emplace(it, std::forward<Args>(args))), ...);
+    return --it;
+  }
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    iterator it = begin();
+    ((it = ++emplace(it, std::forward<Args>(args))), ...);
+  }
+
+ private:
+  static chunk_type *as_chunk(listNode_base *node) noexcept {
+    return static_cast<chunk_type *>(node);
+  }
+
+  // an empty chunk hooked before pos
+  chunk_type *new_chunk(listNode_base *pos) {
+    chunk_type *c = c_traits::allocate(chunk_alloc_, 1);
+    ::new (static_cast<void *>(c)) chunk_type;
+    c->rebase(pos);
+    return c;
+  }
+
+  void destroy_chunk(chunk_type *c) noexcept {
+    T *data = c->data();
+    for (size_type i = 0; i < c->count; ++i)
+      a_traits::destroy(alloc_, data + i);
+    c->unlink();
+    c->~chunk_type();
+    c_traits::deallocate(chunk_alloc_, c, 1);
+  }
+
+  // moves the elements [at, count) of c to a new chunk after it
+  chunk_type *split(chunk_type *c, size_type at) {
+    chunk_type *tail = new_chunk(c->getNext());
+    T *from = c->data();
+    T *to = tail->data();
+    for (size_type i = at; i < c->count; ++i) {
+      a_traits::construct(alloc_, to + tail->count, std::move(from[i]));
+      ++tail->count;
+    }
+    for (size_type i = at; i < c->count; ++i)
+      a_traits::destroy(alloc_, from + i);
+    c->count = at;
+    return tail;
+  }
+
+  // appends the elements of the next chunk to c and frees that chunk
+  void absorb_next(chunk_type *c) {
+    chunk_type *next = as_chunk(c->getNext());
+    T *from = next->data();
+    T *to = c->data();
+    for (size_type i = 0; i < next->count; ++i) {
+      a_traits::construct(alloc_, to + c->count, std::move(from[i]));
+      ++c->count;
+    }
+    destroy_chunk(next);
+  }
+
+  // erases everything from pos to the end
+  void truncate(const_iterator pos) noexcept {
+    listNode_base *node = pos.node();
+    if (node == &fake_node) return;
+    chunk_type *c = as_chunk(node);
+    listNode_base *next = c->getNext();
+    for (size_type i = pos.index(); i < c->count; ++i)
+      a_traits::destroy(alloc_, c->data() + i);
+    size_ -= c->count - pos.index();
+    c->count = pos.index();
+    if (c->count == 0) destroy_chunk(c);
+    while (next != &fake_node) {
+      listNode_base *after = next->getNext();
+      size_ -= as_chunk(next)->count;
+      destroy_chunk(as_chunk(next));
+      next = after;
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_UNROLLED_LIST_H
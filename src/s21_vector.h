@@ -1,6 +1,9 @@
 #ifndef S21_VECTOR_H
 #define S21_VECTOR_H
 #pragma once
+#include <cstring>
+#include <iterator>
+
 #include "s21_containers_common.h"
 
 namespace s21 {
@@ -20,6 +23,10 @@ class VectorIterator_base {
   VectorIterator_base(pointer ptr) : ptr(ptr) {}
   VectorIterator_base(const VectorIterator_base &) = default;
   VectorIterator_base(VectorIterator_base &&) = default;
+  // iterator -> const_iterator conversion
+  template <bool c = is_const, typename = std::enable_if_t<c>>
+  VectorIterator_base(const VectorIterator_base<T, false> &other)
+      : ptr(other.get_pointer()) {}
 
   VectorIterator_base &operator=(const VectorIterator_base &) = default;
   reference operator*() { return *ptr; }
@@ -82,12 +89,60 @@ using VectorIterator = VectorIterator_base<T, false>;
 template <typename T>
 using VectorConstIterator = VectorIterator_base<T, true>;
 
-template <typename T, typename Allocator = std::allocator<T>>
+/* Growth policies: map the number of elements that must fit after an
+ * insertion to the capacity that gets allocated. */
+// required * Num / Den
+template <std::size_t Num, std::size_t Den = 1>
+struct grow_by_factor {
+  static_assert(Num >= Den && Den > 0, "grow_by_factor: factor below 1");
+  std::size_t operator()(std::size_t required) const noexcept {
+    if (required > std::numeric_limits<std::size_t>::max() / Num)
+      return required;
+    return required * Num / Den;
+  }
+};
+using grow_double = grow_by_factor<2>;
+using grow_one_and_half = grow_by_factor<3, 2>;
+
+// required + Step, for huge buffers where doubling wastes too much memory
+template <std::size_t Step>
+struct grow_fixed {
+  std::size_t operator()(std::size_t required) const noexcept {
+    return required + Step;
+  }
+};
+
+// exactly required, every insertion past capacity reallocates
+struct grow_exact {
+  std::size_t operator()(std::size_t required) const noexcept {
+    return required;
+  }
+};
+
+// factor and increment chosen at runtime: required * num / den + step
+struct grow_runtime {
+  std::size_t num = 2, den = 1, step = 0;
+
+  std::size_t operator()(std::size_t required) const noexcept {
+    std::size_t cap = required;
+    if (num != 0 && den != 0 &&
+        required <= std::numeric_limits<std::size_t>::max() / num)
+      cap = required * num / den;
+    if (cap < required) cap = required;
+    return cap + step;
+  }
+};
+
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Growth = grow_double>
 class vector : public s21_sequence_container {
   /* @brief: defines the type of the container size */
   using size_type = std::size_t;
   using a_traits = std::allocator_traits<Allocator>;
-  static const size_type grow_factor = 20;
+  /* @brief: trivially copyable elements are grown by the allocator in place
+   * (see mmap_allocator) instead of being moved one by one */
+  static constexpr bool in_place_growth =
+      has_reallocate<Allocator>::value && std::is_trivially_copyable_v<T>;
 
  public:
   /* @brief: defines the type for iterating through the container */
@@ -101,15 +156,20 @@ class vector : public s21_sequence_container {
 
   /* @brief: defines the type of an element (T is template parameter) */
   using value_type = T;
+  /* @brief: alignment of the buffer guaranteed by the allocator */
+  static constexpr std::size_t alignment =
+      allocator_alignment<Allocator>::value;
   /* @brief: defines the type of the reference to an element */
   using reference = T &;
   /* @brief: defines the type of the constant reference */
   using const_reference = const T &;
+  using allocator_type = Allocator;
 
  private:
   /*private attributes*/
 
   Allocator alloc;
+  Growth growth;
   T *arr = nullptr;
   size_type m_size{};
   size_type m_capacity{};
@@ -126,10 +186,158 @@ class vector : public s21_sequence_container {
   }
 
   // parameterized constructor, creates the vector of size n
-  vector(size_type n) : alloc(Allocator()) { allocate(advanceCapacity(n)); }
+  vector(size_type n, const Allocator &a = Allocator()) : alloc(a) {
+    if (n) allocate(advanceCapacity(n));
+  }
 
-  static size_type advanceCapacity(const size_t n) {
-    return static_cast<size_type>(n * grow_factor / 10.0);
+  size_type advanceCapacity(const size_t n) const {
+    const size_type cap = growth(n);
+    return cap < n ? n : cap;
+  }
+
+  // moves the elements into a buffer of new_cap elements
+  void relocate(size_type new_cap) {
+    if constexpr (in_place_growth) {
+      if (arr != nullptr && new_cap != 0) {
+        arr = alloc.reallocate(arr, m_capacity, new_cap);
+        m_capacity = new_cap;
+        return;
+      }
+    }
+    adopt(new_cap ? a_traits::allocate(alloc, new_cap) : nullptr, new_cap);
+  }
+
+  // Moves the elements into fresh, the ones from ipos on count slots
+  // further, and frees the old buffer. All or nothing: if a copy throws, the
+  // elements built in fresh and the extra one, if any, are destroyed, fresh
+  // is freed and the vector keeps its old buffer.
+  void adopt(T *fresh, size_type new_cap, T *extra = nullptr,
+             size_type ipos = 0, size_type count = 0) {
+    size_type moved = 0;
+    try {
+      for (; moved < m_size; ++moved)
+        a_traits::construct(alloc, fresh + moved + (moved < ipos ? 0 : count),
+                            std::move_if_noexcept(arr[moved]));
+    } catch (...) {
+      for (size_type i = 0; i < moved; ++i)
+        a_traits::destroy(alloc, fresh + i + (i < ipos ? 0 : count));
+      if (extra != nullptr) a_traits::destroy(alloc, extra);
+      if (fresh != nullptr) a_traits::deallocate(alloc, fresh, new_cap);
+      throw;
+    }
+    for (size_type i = 0; i < m_size; ++i) a_traits::destroy(alloc, arr + i);
+    if (arr != nullptr) a_traits::deallocate(alloc, arr, m_capacity);
+    arr = fresh;
+    m_capacity = new_cap;
+  }
+
+  // capacity for growing to n elements in a single step: exact from empty,
+  // geometric otherwise so that repeated resizes stay amortized O(1)
+  size_type resizeCapacity(size_type n) const {
+    const size_type cap = advanceCapacity(m_size);
+    return cap > n ? cap : n;
+  }
+
+  // Opens a gap of count uninitialized slots at ipos, reallocating at most
+  // once. m_size is left unchanged until the caller has filled the gap.
+  T *open_gap(size_type ipos, size_type count) {
+    if (count == 0) return arr + ipos;
+    if (count > max_size() - m_size)
+      throw std::length_error("vector: vector is too big");
+    if (m_size + count > m_capacity) {
+      const size_type new_cap = advanceCapacity(m_size + count);
+      if (!in_place_growth && ipos != m_size) {
+        // move the elements straight to their final slots
+        adopt(a_traits::allocate(alloc, new_cap), new_cap, nullptr, ipos,
+              count);
+        return arr + ipos;
+      }
+      relocate(new_cap);
+    }
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      if (ipos != m_size)
+        std::memmove(static_cast<void *>(arr + ipos + count),
+                     static_cast<const void *>(arr + ipos),
+                     (m_size - ipos) * sizeof(T));
+    } else {
+      for (size_type i = m_size; i-- > ipos;) {
+        if (i + count >= m_size)
+          a_traits::construct(alloc, arr + i + count, std::move(arr[i]));
+        else
+          arr[i + count] = std::move(arr[i]);
+      }
+      // the gap still holds moved-from elements
+      for (size_type i = ipos; i < ipos + count && i < m_size; ++i)
+        a_traits::destroy(alloc, arr + i);
+    }
+    return arr + ipos;
+  }
+
+  // Undoes open_gap() after the gap has been emptied again.
+  void close_gap(size_type ipos, size_type count) noexcept {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      std::memmove(static_cast<void *>(arr + ipos),
+                   static_cast<const void *>(arr + ipos + count),
+                   (m_size - ipos) * sizeof(T));
+    } else {
+      for (size_type i = ipos; i < m_size; ++i) {
+        if (i < ipos + count)
+          a_traits::construct(alloc, arr + i, std::move(arr[i + count]));
+        else
+          arr[i] = std::move(arr[i + count]);
+      }
+      for (size_type i = std::max(m_size, ipos + count); i < m_size + count;
+           ++i)
+        a_traits::destroy(alloc, arr + i);
+    }
+  }
+
+  // Inserts count elements at ipos; build(gap, built) constructs them one by
+  // one, counting them in built. On exception the vector is left unchanged.
+  template <typename Build>
+  void fill_gap(size_type ipos, size_type count, Build &&build) {
+    T *gap = open_gap(ipos, count);
+    size_type built = 0;
+    try {
+      build(gap, built);
+    } catch (...) {
+      for (size_type i = 0; i < built; ++i) a_traits::destroy(alloc, gap + i);
+      close_gap(ipos, count);
+      throw;
+    }
+    m_size += count;
+  }
+
+  size_type checked_pos(const_iterator pos) const {
+    if (pos < cbegin() || pos > cend())
+      throw(std::out_of_range("vector: insert pos is out of range"));
+    return pos - cbegin();
+  }
+
+  // whether value is one of our own elements
+  template <typename U>
+  bool points_into(const U &value) const noexcept {
+    if constexpr (std::is_same_v<std::decay_t<U>, T>)
+      return std::less_equal<const T *>()(arr, &value) &&
+             std::less<const T *>()(&value, arr + m_size);
+    else
+      return false;
+  }
+
+  // destroys the elements from new_size on
+  void destroy_tail(size_type new_size) noexcept {
+    for (size_type i = new_size; i < m_size; ++i)
+      a_traits::destroy(alloc, arr + i);
+    m_size = new_size;
+  }
+
+  template <typename Construct>
+  void resize_with(size_type count, Construct &&construct) {
+    if (count < m_size) return destroy_tail(count);
+    if (count > max_size())
+      throw std::length_error("vector: vector is too big");
+    if (count > m_capacity) relocate(resizeCapacity(count));
+    for (; m_size < count; ++m_size) construct(arr + m_size);
   }
 
  public:
@@ -137,24 +345,32 @@ class vector : public s21_sequence_container {
   /* @brief: основные публичные методы для взаимодействия с классом: */
   // default constructor, creates empty vector
   vector() noexcept : vector(0) {}
+  // creates empty vector that allocates through a copy of a
+  explicit vector(const Allocator &a) noexcept : vector(0, a) {}
 
   // initializer list constructor, creates vector initizialized using
   // std::initializer_list<T>
-  vector(std::initializer_list<value_type> const &items)
-      : vector(items.size()) {
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &a = Allocator())
+      : vector(items.size(), a) {
     for (auto itt = items.end(), it = items.begin(); it != itt; ++it)
       a_traits::construct(alloc, arr + (m_size++), *it);
   }
 
   // copy constructor
-  vector(const vector &v) {
-    allocate(advanceCapacity(v.size()));
+  vector(const vector &v)
+      : alloc(a_traits::select_on_container_copy_construction(v.alloc)),
+        growth(v.growth) {
+    if (v.size()) allocate(advanceCapacity(v.size()));
     for (auto itt = v.end(), it = v.begin(); it != itt; ++it)
       a_traits::construct(alloc, arr + (m_size++), *it);
   }
   // move constructor
   vector(vector &&v) noexcept
-      : alloc(v.alloc), arr(v.arr), m_size(v.m_size), m_capacity(v.m_capacity) {
+      : alloc(v.alloc),
+        growth(v.growth),
+        arr(v.arr),
+        m_size(v.m_size), m_capacity(v.m_capacity) {
     v.arr = nullptr;
     v.m_size = v.m_capacity = 0;
   }
@@ -195,17 +411,34 @@ class vector : public s21_sequence_container {
   const_reference operator[](size_type pos) const { return *(arr + pos); }
 
   // access the first element
+  reference front() {
+    if (empty()) throw std::out_of_range("vector: vektor is empty");
+    return arr[0];
+  }
   const_reference front() const {
     if (empty()) throw std::out_of_range("vector: vektor is empty");
     return *begin();
   }
   // access the last element
+  reference back() {
+    if (empty()) throw std::out_of_range("vector: vektor is empty");
+    return arr[m_size - 1];
+  }
   const_reference back() const {
     if (empty()) throw std::out_of_range("vector: vektor is empty");
     return *(end() - 1);
   }
   // direct access to the underlying array
   T *data() noexcept { return arr; }
+  const T *data() const noexcept { return arr; }
+  // data() with the allocator's alignment promised to the optimizer, for
+  // vectorized consumers
+  T *aligned_data() noexcept {
+    return static_cast<T *>(__builtin_assume_aligned(arr, alignment));
+  }
+  const T *aligned_data() const noexcept {
+    return static_cast<const T *>(__builtin_assume_aligned(arr, alignment));
+  }
   /*Vector Iterators*/
   // returns an iterator to the beginning
   iterator begin() noexcept { return iterator{arr}; }
@@ -231,95 +464,256 @@ class vector : public s21_sequence_container {
   size_type max_size() const noexcept {
     return static_cast<size_type>((-1) / sizeof(T));
   };
+  // returns the allocator the buffer comes from
+  Allocator get_allocator() const { return alloc; }
   // allocate storage of size elements and copies current array elements to a
   // newely allocated array
   void reserve(size_type size) {
     if (size > max_size()) throw std::length_error("vector: vector is too big");
 
-    if (size > capacity()) {
-      T *oldarr = arr;
-      arr = a_traits::allocate(alloc, size);
-      for (size_type sz = this->size(), i = 0; i < sz; ++i)
-        arr[i] = std::move(oldarr[i]);
-      a_traits::deallocate(alloc, oldarr, m_capacity);
-      m_capacity = size;
-    }
+    if (size > capacity()) relocate(size);
   }
   // returns the number of elements that can be held in currently allocated
   // storage
   size_type capacity() const noexcept { return m_capacity; }
   // reduces memory usage by freeing unused memory
   void shrink_to_fit() {
-    auto new_arr = a_traits::allocate(alloc, m_size);
-    for (size_type i = 0; i < m_size; ++i)
-      a_traits::construct(alloc, new_arr + i, std::move(arr[i]));
-    std::swap(arr, new_arr);
-    a_traits::deallocate(alloc, new_arr, m_capacity);
-    m_capacity = m_size;
+    if (m_capacity != m_size) relocate(m_size);
   }
 
+  /*Vector Growth*/
+  // returns the growth policy
+  const Growth &growth_policy() const noexcept { return growth; }
+  // replaces the growth policy used by the following reallocations
+  void set_growth_policy(const Growth &policy) { growth = policy; }
+
   /*Vector Modifiers*/
   // clears the contents
-  void clear() {
-    for (size_type sz = size(), i = 0; i < sz; ++i)
-      a_traits::destroy(alloc, arr + i);
-    m_size = 0;
-  }
+  void clear() { destroy_tail(0); }
   // inserts elements into concrete pos and returns the iterator that points
   // to the new element
-  iterator insert(iterator pos, const_reference value) {
-    return insert_many(const_iterator(pos.get_pointer()), value);
+  iterator insert(const_iterator pos, const_reference value) {
+    return insert_many(pos, value);
+  }
+  iterator insert(const_iterator pos, value_type &&value) {
+    return insert_many(pos, std::move(value));
+  }
+  // inserts count copies of value before pos
+  iterator insert(const_iterator pos, size_type count,
+                  const_reference value) {
+    const size_type ipos = checked_pos(pos);
+    if (points_into(value)) return insert(pos, count, value_type(value));
+    fill_gap(ipos, count, [&](T *gap, size_type &built) {
+      for (; built < count; ++built)
+        a_traits::construct(alloc, gap + built, value);
+    });
+    return begin() + ipos;
+  }
+  // inserts [first, last) before pos, reallocating at most once for forward
+  // iterators. The range must not point into this vector.
+  template <typename InputIt,
+            typename Category =
+                typename std::iterator_traits<InputIt>::iterator_category>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type ipos = checked_pos(pos);
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      const size_type count = std::distance(first, last);
+      fill_gap(ipos, count, [&](T *gap, size_type &built) {
+        for (; built < count; ++built, ++first)
+          a_traits::construct(alloc, gap + built, *first);
+      });
+    } else {
+      for (size_type i = ipos; first != last; ++first, ++i)
+        emplace(cbegin() + i, *first);
+    }
+    return begin() + ipos;
+  }
+  iterator insert(const_iterator pos, std::initializer_list<value_type> il) {
+    return insert(pos, il.begin(), il.end());
+  }
+  // constructs an element in place before pos
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    const size_type ipos = checked_pos(pos);
+    if (ipos == m_size) {
+      emplace_back(std::forward<Args>(args)...);
+    } else if ((points_into(args) || ...)) {
+      value_type tmp(std::forward<Args>(args)...);
+      fill_gap(ipos, 1, [&](T *gap, size_type &built) {
+        a_traits::construct(alloc, gap, std::move(tmp));
+        ++built;
+      });
+    } else {
+      fill_gap(ipos, 1, [&](T *gap, size_type &built) {
+        a_traits::construct(alloc, gap, std::forward<Args>(args)...);
+        ++built;
+      });
+    }
+    return begin() + ipos;
+  }
+  // appends all elements of a range (anything with begin() and end())
+  template <typename Range>
+  void append_range(const Range &range) {
+    using std::begin;
+    using std::end;
+    insert(cend(), begin(range), end(range));
+  }
+  // replaces the contents with [first, last)
+  template <typename InputIt,
+            typename Category =
+                typename std::iterator_traits<InputIt>::iterator_category>
+  void assign(InputIt first, InputIt last) {
+    clear();
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      const size_type count = std::distance(first, last);
+      if (count > m_capacity) relocate(count);
+    }
+    insert(cend(), first, last);
+  }
+  // replaces the contents with count copies of value
+  void assign(size_type count, const_reference value) {
+    if (points_into(value)) return assign(count, value_type(value));
+    clear();
+    if (count > m_capacity) relocate(count);
+    insert(cend(), count, value);
+  }
+  void assign(std::initializer_list<value_type> il) {
+    assign(il.begin(), il.end());
+  }
+  // changes the number of elements, new ones are value-initialized
+  void resize(size_type count) {
+    resize_with(count, [this](T *p) { a_traits::construct(alloc, p); });
+  }
+  // changes the number of elements, new ones are copies of value
+  void resize(size_type count, const_reference value) {
+    if (count > m_size && points_into(value))
+      return resize(count, value_type(value));
+    resize_with(count,
+                [this, &value](T *p) { a_traits::construct(alloc, p, value); });
   }
-  // erases element at pos
-  void erase(iterator pos) {
-    const size_type ipos = pos - begin();
-    if (ipos >= size() || begin() > pos)
+  // changes the number of elements, new ones are default-initialized: trivial
+  // types are left uninitialized, for buffers that are overwritten right away
+  // (e.g. read() targets). The allocator's construct() is bypassed.
+  void resize_default_init(size_type count) {
+    resize_with(count, [](T *p) { ::new (static_cast<void *>(p)) T; });
+  }
+  // erases element at pos, returns the iterator following it
+  iterator erase(const_iterator pos) {
+    const size_type ipos = pos - cbegin();
+    if (ipos >= size() || cbegin() > pos)
       throw(std::out_of_range("vector: erase pos is out of range"));
-    a_traits::destroy(alloc, arr + ipos);
-    for (auto sz = size() - 1, i = ipos; i < sz; ++i) {
-      a_traits::construct(alloc, arr + i, std::move(arr[i + 1]));
+    return erase(pos, pos + 1);
+  }
+  // erases [first, last) in one pass over the tail
+  iterator erase(const_iterator first, const_iterator last) {
+    if (first < cbegin() || last > cend() || last < first)
+      throw(std::out_of_range("vector: erase range is out of range"));
+    const size_type ifirst = first - cbegin(), ilast = last - cbegin();
+    if (ifirst == ilast) return begin() + ifirst;
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      std::memmove(static_cast<void *>(arr + ifirst),
+                   static_cast<const void *>(arr + ilast),
+                   (m_size - ilast) * sizeof(T));
+    } else {
+      std::move(arr + ilast, arr + m_size, arr + ifirst);
     }
-    --m_size;
+    destroy_tail(m_size - (ilast - ifirst));
+    return begin() + ifirst;
+  }
+  // erases the element at pos by moving the last element into its place;
+  // O(1) but does not keep the order
+  iterator unordered_erase(const_iterator pos) {
+    const size_type ipos = pos - cbegin();
+    if (ipos >= size() || cbegin() > pos)
+      throw(std::out_of_range("vector: erase pos is out of range"));
+    if (ipos != m_size - 1) arr[ipos] = std::move(arr[m_size - 1]);
+    destroy_tail(m_size - 1);
+    return begin() + ipos;
+  }
+  // erases every element satisfying pred in a single compacting pass,
+  // keeping the order of the others; returns the number of erased elements
+  template <typename Pred>
+  size_type erase_if(Pred pred) {
+    size_type kept = 0, i = 0;
+    try {
+      for (; i < m_size; ++i) {
+        if (pred(arr[i])) continue;
+        if (kept != i) arr[kept] = std::move(arr[i]);
+        ++kept;
+      }
+    } catch (...) {
+      // close the hole left so far and keep the unvisited elements
+      std::move(arr + i, arr + m_size, arr + kept);
+      destroy_tail(kept + (m_size - i));
+      throw;
+    }
+    const size_type erased = m_size - kept;
+    destroy_tail(kept);
+    return erased;
   }
   // adds an element to the end
-  void push_back(const_reference value) { insert_many_back(value); }
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  // constructs an element in place at the end
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    if (m_size == m_capacity) {
+      const size_type new_cap = advanceCapacity(m_size + 1);
+      if constexpr (in_place_growth) {
+        value_type tmp(std::forward<Args>(args)...);
+        relocate(new_cap);
+        a_traits::construct(alloc, arr + m_size, std::move(tmp));
+      } else {
+        // the new element is built first, args may refer to our elements
+        T *new_arr = a_traits::allocate(alloc, new_cap);
+        try {
+          a_traits::construct(alloc, new_arr + m_size,
+                              std::forward<Args>(args)...);
+        } catch (...) {
+          a_traits::deallocate(alloc, new_arr, new_cap);
+          throw;
+        }
+        adopt(new_arr, new_cap, new_arr + m_size);
+      }
+    } else {
+      a_traits::construct(alloc, arr + m_size, std::forward<Args>(args)...);
+    }
+    return arr[m_size++];
+  }
   // removes the last element
-  void pop_back() { erase(end() - 1); }
+  void pop_back() {
+    if (empty()) throw(std::out_of_range("vector: vektor is empty"));
+    destroy_tail(m_size - 1);
+  }
   // swaps the contents
   void swap(vector &other) {
+    std::swap(alloc, other.alloc);
     std::swap(arr, other.arr);
     std::swap(m_size, other.m_size);
     std::swap(m_capacity, other.m_capacity);
+    std::swap(growth, other.growth);
   }
+  // inserts args before pos, reallocating at most once
   template <class... Args>
   iterator insert_many(const_iterator pos, Args &&...args) {
-    const size_type ipos = pos - cbegin();
+    const size_type ipos = checked_pos(pos);
     const size_type count = sizeof...(Args);
-    if (ipos > size() || pos < cbegin())
-      throw(std::out_of_range("vector: insert pos is out of range"));
     try {
-      if (size() + count > capacity()) {
-        auto new_arr =
-            a_traits::allocate(alloc, advanceCapacity(size() + count));
-        // переносим элементы из старого массива с дыркой под новый элемент
-        for (size_type i = 0; i < ipos; ++i) {
-          a_traits::construct(alloc, new_arr + i, std::move(arr[i]));
-        }
-        for (size_type i = ipos; i < m_size; ++i) {
-          a_traits::construct(alloc, new_arr + i + count, std::move(arr[i]));
-        }
-        std::swap(new_arr, arr);
-        a_traits::deallocate(alloc, new_arr, m_capacity);
-        m_capacity = advanceCapacity(size() + count);
+      if ((points_into(args) || ...)) {
+        // copies first, the gap would move the originals away
+        vector tmp(alloc);
+        tmp.reserve(count);
+        (tmp.emplace_back(std::forward<Args>(args)), ...);
+        fill_gap(ipos, count, [&](T *gap, size_type &built) {
+          for (; built < count; ++built)
+            a_traits::construct(alloc, gap + built, std::move(tmp[built]));
+        });
       } else {
-        for (auto i = m_size + count - 1; i >= ipos + count; --i) {
-          a_traits::construct(alloc, arr + i, std::move(arr[i - count]));
-        }
-      }
-      auto insptr = arr + ipos;
-      for (auto arg : {std::forward<Args>(args)...}) {
-        a_traits::construct(alloc, insptr++, std::forward<decltype(arg)>(arg));
-        ++m_size;
+        fill_gap(ipos, count, [&](T *gap, size_type &built) {
+          ((a_traits::construct(alloc, gap + built, std::forward<Args>(args)),
+            ++built),
+           ...);
+        });
       }
     } catch (const std::exception &e) {
       throw std::runtime_error("vector: exception while inserting element: " +
@@ -334,6 +728,18 @@ class vector : public s21_sequence_container {
   }
 };
 
+// erases the elements satisfying pred, returns how many were erased
+template <typename T, typename A, typename G, typename Pred>
+std::size_t erase_if(vector<T, A, G> &v, Pred pred) {
+  return v.erase_if(pred);
+}
+
+// erases the elements equal to value, returns how many were erased
+template <typename T, typename A, typename G, typename U>
+std::size_t erase(vector<T, A, G> &v, const U &value) {
+  return v.erase_if([&value](const T &x) { return x == value; });
+}
+
 /* Дедукция типа. Создание объекта типа vector<T> без указания типа с помощью
  * нотации {1,2,3,4,5} */
 template <typename T>
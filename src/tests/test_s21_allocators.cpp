@@ -0,0 +1,268 @@
+#include "test_s21_containers.h"
+
+#include <cstdint>
+#include <thread>
+
+using s21::huge_page_allocator;
+using s21::huge_page_mode;
+using s21::allocation_stats;
+using s21::tracking_allocator;
+
+TEST(testHugePageAllocator, vectorSmall) {
+  s21::vector<int, huge_page_allocator<int>> v = {1, 2, 3};
+  v.push_back(4);
+  ASSERT_EQ(v.size(), 4);
+  ASSERT_EQ(v[3], 4);
+}
+
+TEST(testHugePageAllocator, vectorMapped) {
+  s21::vector<int, huge_page_allocator<int, 4096>> v;
+  v.reserve(1 << 20);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % (2 << 20), 0);
+  for (int i = 0; i < (1 << 20); ++i) v.push_back(i);
+  ASSERT_EQ(v.capacity(), 1 << 20);
+  ASSERT_EQ(v[12345], 12345);
+  v.push_back(-1);
+  ASSERT_EQ(v.back(), -1);
+  ASSERT_EQ(v[(1 << 20) - 1], (1 << 20) - 1);
+}
+
+TEST(testHugePageAllocator, prefault) {
+  using prefaulted =
+      huge_page_allocator<long, 4096, huge_page_mode::prefault>;
+  using both =
+      huge_page_allocator<long, 4096, huge_page_mode::transparent_prefault>;
+  s21::vector<long, prefaulted> v1;
+  s21::vector<long, both> v2;
+  v1.reserve(100000);
+  v2.reserve(100000);
+  for (long i = 0; i < 100000; ++i) {
+    v1.push_back(i);
+    v2.push_back(-i);
+  }
+  ASSERT_EQ(v1[99999], 99999);
+  ASSERT_EQ(v2[99999], -99999);
+}
+
+TEST(testHugePageAllocator, list) {
+  s21::list<int, huge_page_allocator<int>> l = {3, 1, 2};
+  l.push_front(0);
+  l.sort();
+  ASSERT_EQ(l.size(), 4);
+  ASSERT_EQ(l.front(), 0);
+  ASSERT_EQ(l.back(), 3);
+  l.clear();
+  ASSERT_TRUE(l.empty());
+}
+
+namespace {
+template <typename T>
+bool aligned_to(const T *p, std::size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+struct alignas(64) cache_line_record {
+  char bytes[64];
+};
+}  // namespace
+
+TEST(testAlignedAllocator, vectorReallocations) {
+  using alloc = s21::aligned_allocator<float, 32>;
+  s21::vector<float, alloc> v = {1, 2, 3};
+  ASSERT_EQ((s21::vector<float, alloc>::alignment), 32);
+  ASSERT_TRUE(aligned_to(v.data(), 32));
+  v.reserve(1000);
+  ASSERT_TRUE(aligned_to(v.data(), 32));
+  v.shrink_to_fit();
+  ASSERT_TRUE(aligned_to(v.data(), 32));
+  v.insert_many(v.cbegin() + 1, 7.0f, 8.0f, 9.0f);
+  ASSERT_TRUE(aligned_to(v.data(), 32));
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(static_cast<float>(i));
+    ASSERT_TRUE(aligned_to(v.aligned_data(), 32));
+  }
+  ASSERT_EQ(v.aligned_data(), v.data());
+  ASSERT_FLOAT_EQ(v[1], 7.0f);
+}
+
+TEST(testAlignedAllocator, cacheLineRecords) {
+  s21::vector<cache_line_record, s21::aligned_allocator<cache_line_record>> v;
+  for (int i = 0; i < 10; ++i) v.push_back(cache_line_record{{char(i)}});
+  for (int i = 0; i < 10; ++i) ASSERT_TRUE(aligned_to(&v[i], 64));
+  ASSERT_EQ(v[9].bytes[0], 9);
+}
+
+TEST(testAlignedAllocator, defaultAlignment) {
+  ASSERT_EQ(s21::vector<double>::alignment, alignof(double));
+  ASSERT_EQ((s21::vector<int, s21::mmap_allocator<int>>::alignment),
+            alignof(std::max_align_t));
+  const s21::vector<double> empty;
+  ASSERT_EQ(empty.aligned_data(), nullptr);
+}
+
+TEST(testTrackingAllocator, vector) {
+  s21::vector<int, tracking_allocator<int>> v;
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  const allocation_stats &stats = v.get_allocator().stats();
+  // capacities 2, 6, 14, 30, 62, 126
+  ASSERT_EQ(stats.allocations(), 6U);
+  ASSERT_EQ(stats.deallocations(), 5U);
+  ASSERT_EQ(stats.live_bytes(), 126 * sizeof(int));
+  ASSERT_EQ(stats.peak_bytes(), (126 + 62) * sizeof(int));
+  ASSERT_EQ(stats.allocated_bytes(), 240 * sizeof(int));
+  ASSERT_EQ(stats.histogram(allocation_stats::bucket_of(126 * 4)), 1U);
+  ASSERT_EQ(stats.histogram(allocation_stats::bucket_of(8)), 1U);
+  v.shrink_to_fit();
+  ASSERT_EQ(stats.live_bytes(), 100 * sizeof(int));
+}
+
+TEST(testTrackingAllocator, vectorCopy) {
+  s21::vector<int, tracking_allocator<int>> v{1, 2, 3};
+  const allocation_stats &stats = v.get_allocator().stats();
+  s21::vector<int, tracking_allocator<int>> copy(v);
+  // the copy reports into the source's stats
+  ASSERT_EQ(&copy.get_allocator().stats(), &stats);
+  ASSERT_EQ(stats.allocations(), 2U);
+  ASSERT_EQ(stats.live_bytes(),
+            (v.capacity() + copy.capacity()) * sizeof(int));
+  copy.shrink_to_fit();
+  ASSERT_EQ(stats.allocations(), 3U);
+  ASSERT_EQ(stats.deallocations(), 1U);
+  ASSERT_EQ(copy[2], 3);
+  // the temporary insert_many() copies aliased arguments into is tracked
+  copy.insert_many(copy.cbegin(), copy[0], copy[1]);
+  ASSERT_EQ(stats.allocations(), 5U);
+  ASSERT_EQ(stats.live_bytes(),
+            (v.capacity() + copy.capacity()) * sizeof(int));
+}
+
+TEST(testTrackingAllocator, perInstanceAndGlobal) {
+  const std::size_t global_before = allocation_stats::global().allocations();
+  const std::size_t live_before = allocation_stats::global().live_bytes();
+  {
+    s21::list<int, tracking_allocator<int>> a{1, 2, 3};
+    s21::list<int, tracking_allocator<int>> b{4};
+    ASSERT_EQ(a.get_allocator().stats().allocations(), 3U);
+    ASSERT_EQ(b.get_allocator().stats().allocations(), 1U);
+    ASSERT_EQ(allocation_stats::global().allocations() - global_before, 4U);
+    // the counters travel with the nodes
+    a.swap(b);
+    ASSERT_EQ(a.get_allocator().stats().allocations(), 1U);
+    a.pop_back();
+    b.pop_back();
+    ASSERT_EQ(a.get_allocator().stats().live_bytes(), 0U);
+    ASSERT_EQ(b.get_allocator().stats().deallocations(), 1U);
+  }
+  ASSERT_EQ(allocation_stats::global().live_bytes(), live_before);
+}
+
+TEST(testTrackingAllocator, sharedStats) {
+  auto stats = std::make_shared<allocation_stats>();
+  tracking_allocator<int> alloc(stats);
+  // rebinding to the node type keeps the stats
+  tracking_allocator<double> rebound(alloc);
+  ASSERT_EQ(&rebound.stats(), stats.get());
+  ASSERT_TRUE(rebound == alloc);
+  double *p = rebound.allocate(3);
+  ASSERT_EQ(stats->live_bytes(), 3 * sizeof(double));
+  rebound.deallocate(p, 3);
+  ASSERT_EQ(stats->allocations(), 1U);
+  ASSERT_EQ(stats->deallocations(), 1U);
+  ASSERT_EQ(stats->live_bytes(), 0U);
+  ASSERT_EQ(stats->peak_bytes(), 3 * sizeof(double));
+  stats->reset();
+  {
+    // both containers report into stats
+    s21::vector<int, tracking_allocator<int>> v({1, 2}, alloc);
+    s21::list<int, tracking_allocator<int>> l({1, 2, 3}, alloc);
+    ASSERT_TRUE(alloc == v.get_allocator());
+    ASSERT_EQ(&l.get_allocator().stats(), stats.get());
+    // one buffer for the vector, one node per list element
+    ASSERT_EQ(stats->allocations(), 4U);
+    s21::deque<int, tracking_allocator<int>> d(alloc);
+    s21::set<int, tracking_allocator<int>> s(alloc);
+    s21::queue<int, s21::ring_buffer<int, tracking_allocator<int>>> q(alloc);
+    s21::stack<int, s21::vector<int, tracking_allocator<int>>> st({1}, alloc);
+    d.push_back(1);
+    s.insert(1);
+    q.push(1);
+    ASSERT_EQ(&q.get_allocator().stats(), stats.get());
+    ASSERT_EQ(&st.get_allocator().stats(), stats.get());
+    // deque map and block, set end node and node, ring and stack buffers
+    ASSERT_EQ(stats->allocations(), 10U);
+  }
+  ASSERT_EQ(stats->live_bytes(), 0U);
+  ASSERT_EQ(stats->allocations(), stats->deallocations());
+  stats->reset();
+  ASSERT_EQ(stats->allocations(), 0U);
+  ASSERT_EQ(stats->peak_bytes(), 0U);
+}
+
+TEST(testTrackingAllocator, treesAndAdapters) {
+  s21::set<int, tracking_allocator<int>> s{3, 1, 2};
+  // one node per element plus the end node
+  ASSERT_EQ(s.get_allocator().stats().allocations(), 4U);
+  s.erase(s.find(2));
+  ASSERT_EQ(s.get_allocator().stats().deallocations(), 1U);
+
+  s21::map<int, char, tracking_allocator<std::pair<const int, char>>> m;
+  m.insert(1, 'a');
+  m[2] = 'b';
+  ASSERT_EQ(m.get_allocator().stats().allocations(), 3U);
+  auto moved = std::move(m);
+  ASSERT_EQ(moved.get_allocator().stats().allocations(), 3U);
+
+  s21::multiset<int, tracking_allocator<int>> ms{1, 1, 1};
+  ASSERT_EQ(ms.get_allocator().stats().allocations(), 4U);
+
+  s21::queue<int, s21::list<int, tracking_allocator<int>>> q{1, 2, 3};
+  q.pop();
+  ASSERT_EQ(q.get_allocator().stats().allocations(), 3U);
+  ASSERT_EQ(q.get_allocator().stats().deallocations(), 1U);
+  s21::queue<int, s21::ring_buffer<int, tracking_allocator<int>>> ring;
+  for (int i = 0; i < 100; ++i) {
+    ring.push(i);
+    if (i % 2) ring.pop();
+  }
+  // 8 -> 16 -> 32 -> 64 slots
+  ASSERT_EQ(ring.get_allocator().stats().allocations(), 4U);
+
+  s21::stack<int, s21::list<int, tracking_allocator<int>>> st{1, 2};
+  st.insert_many_back(3, 4);
+  ASSERT_EQ(st.get_allocator().stats().allocations(), 4U);
+  ASSERT_EQ(st.top(), 2);
+  s21::stack<int, s21::vector<int, tracking_allocator<int>>> block;
+  for (int i = 0; i < 100; ++i) block.push(i);
+  // one block, doubled as it fills
+  ASSERT_LE(block.get_allocator().stats().allocations(), 8U);
+}
+
+TEST(testTrackingAllocator, reallocate) {
+  using alloc = tracking_allocator<int, s21::mmap_allocator<int, 4096>>;
+  static_assert(s21::has_reallocate<alloc>::value);
+  static_assert(!s21::has_reallocate<tracking_allocator<int>>::value);
+  s21::vector<int, alloc> v;
+  for (int i = 0; i < 10000; ++i) v.push_back(i);
+  const allocation_stats &stats = v.get_allocator().stats();
+  ASSERT_EQ(stats.allocations(), 1U);
+  ASSERT_GT(stats.reallocations(), 0U);
+  ASSERT_EQ(stats.live_bytes(), v.capacity() * sizeof(int));
+  ASSERT_EQ(v[9999], 9999);
+}
+
+TEST(testTrackingAllocator, threads) {
+  auto stats = std::make_shared<allocation_stats>();
+  s21::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.push_back(std::thread([stats] {
+      tracking_allocator<long> alloc(stats);
+      for (int i = 0; i < 1000; ++i) alloc.deallocate(alloc.allocate(4), 4);
+    }));
+  }
+  for (auto &t : threads) t.join();
+  ASSERT_EQ(stats->allocations(), 4000U);
+  ASSERT_EQ(stats->deallocations(), 4000U);
+  ASSERT_EQ(stats->live_bytes(), 0U);
+  ASSERT_GE(stats->peak_bytes(), 4 * sizeof(long));
+  ASSERT_LE(stats->peak_bytes(), 16 * sizeof(long));
+}
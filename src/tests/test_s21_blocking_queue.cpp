@@ -0,0 +1,101 @@
+#include "test_s21_containers.h"
+
+#include <chrono>
+#include <iterator>
+#include <thread>
+
+using s21::blocking_queue;
+using s21::queue_op_status;
+using namespace std::chrono_literals;
+
+TEST(testBlockingQueue, tryAndTimeouts) {
+  blocking_queue<int> q(2);
+  ASSERT_EQ(q.capacity(), 2U);
+  ASSERT_TRUE(q.empty());
+  int out = -1;
+  ASSERT_EQ(q.try_pop(out), queue_op_status::empty);
+  ASSERT_EQ(q.pop_for(out, 1ms), queue_op_status::timeout);
+  ASSERT_EQ(q.try_push(1), queue_op_status::success);
+  ASSERT_EQ(q.push(2), queue_op_status::success);
+  ASSERT_EQ(q.try_push(3), queue_op_status::full);
+  ASSERT_EQ(q.push_for(3, 1ms), queue_op_status::timeout);
+  ASSERT_EQ(q.size(), 2U);
+  ASSERT_EQ(q.pop_for(out, 1ms), queue_op_status::success);
+  ASSERT_EQ(out, 1);
+  ASSERT_EQ(q.push_for(3, 1ms), queue_op_status::success);
+  ASSERT_EQ(q.pop(out), queue_op_status::success);
+  ASSERT_EQ(out, 2);
+  ASSERT_THROW(blocking_queue<int>(0), std::length_error);
+}
+
+TEST(testBlockingQueue, closeDrains) {
+  blocking_queue<std::unique_ptr<int>> q(4);
+  q.push(std::make_unique<int>(1));
+  q.emplace(new int(2));
+  q.close();
+  ASSERT_TRUE(q.closed());
+  ASSERT_EQ(q.push(std::make_unique<int>(3)), queue_op_status::closed);
+  ASSERT_EQ(q.try_push(std::make_unique<int>(4)), queue_op_status::closed);
+  std::unique_ptr<int> out;
+  ASSERT_EQ(q.pop(out), queue_op_status::success);
+  ASSERT_EQ(*out, 1);
+  ASSERT_EQ(q.try_pop(out), queue_op_status::success);
+  ASSERT_EQ(*out, 2);
+  ASSERT_EQ(q.pop(out), queue_op_status::closed);
+  ASSERT_EQ(q.try_pop(out), queue_op_status::closed);
+  ASSERT_EQ(q.pop_for(out, 1h), queue_op_status::closed);
+}
+
+TEST(testBlockingQueue, closeWakesWaiters) {
+  blocking_queue<int> q(1);
+  q.push(0);
+  queue_op_status pushed = queue_op_status::success;
+  std::thread producer([&] { pushed = q.push(1); });
+  std::this_thread::sleep_for(10ms);
+  q.close();
+  producer.join();
+  ASSERT_EQ(pushed, queue_op_status::closed);
+  std::vector<int> out;
+  ASSERT_EQ(q.pop_batch(std::back_inserter(out), 8, 1h), 1U);
+  ASSERT_EQ(q.pop_batch(std::back_inserter(out), 8, 1h), 0U);
+}
+
+TEST(testBlockingQueue, popBatch) {
+  blocking_queue<int> q(10);
+  std::vector<int> out;
+  ASSERT_EQ(q.pop_batch(std::back_inserter(out), 4, 1ms), 0U);
+  for (int i = 0; i < 7; ++i) q.push(i);
+  ASSERT_EQ(q.pop_batch(std::back_inserter(out), 4, 1ms), 4U);
+  ASSERT_EQ(q.pop_batch(std::back_inserter(out), 0, 1ms), 0U);
+  ASSERT_EQ(q.pop_batch(std::back_inserter(out), 4, 1ms), 3U);
+  ASSERT_EQ(out, (std::vector<int>{0, 1, 2, 3, 4, 5, 6}));
+}
+
+TEST(testBlockingQueue, pipeline) {
+  constexpr int kProducers = 3, kConsumers = 3, kItems = 20000;
+  blocking_queue<int> q(8);
+  std::atomic<long long> sum{0};
+  std::vector<std::thread> producers, consumers;
+  for (int p = 0; p < kProducers; ++p)
+    producers.emplace_back([&, p] {
+      for (int i = p; i < kItems; i += kProducers) q.push(i);
+    });
+  for (int c = 0; c < kConsumers; ++c)
+    consumers.emplace_back([&, c] {
+      int batch[5], item;
+      for (;;) {
+        if (c == 0) {
+          const std::size_t n = q.pop_batch(batch, 5, 1h);
+          if (n == 0) break;
+          for (std::size_t k = 0; k < n; ++k) sum += batch[k];
+        } else {
+          if (q.pop(item) == queue_op_status::closed) break;
+          sum += item;
+        }
+      }
+    });
+  for (auto &thread : producers) thread.join();
+  q.close();
+  for (auto &thread : consumers) thread.join();
+  ASSERT_EQ(sum, 1LL * kItems * (kItems - 1) / 2);
+}
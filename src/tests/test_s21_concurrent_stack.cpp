@@ -0,0 +1,147 @@
+#include "test_s21_containers.h"
+
+#include <atomic>
+#include <iterator>
+#include <thread>
+
+using s21::concurrent_stack;
+
+TEST(testConcurrentStack, lifo) {
+  concurrent_stack<int> s;
+  ASSERT_TRUE(s.empty());
+  int out = -1;
+  ASSERT_FALSE(s.try_pop(out));
+  for (int i = 0; i < 10; ++i) s.push(i);
+  ASSERT_FALSE(s.empty());
+  for (int i = 9; i >= 0; --i) {
+    ASSERT_TRUE(s.try_pop(out));
+    ASSERT_EQ(out, i);
+  }
+  ASSERT_FALSE(s.try_pop(out));
+  ASSERT_TRUE(s.empty());
+}
+
+TEST(testConcurrentStack, moveOnlyAndLeftovers) {
+  auto counter = std::make_shared<int>(0);
+  {
+    concurrent_stack<std::shared_ptr<int>> s;
+    for (int i = 0; i < 5; ++i) s.push(counter);
+    std::shared_ptr<int> out;
+    s.try_pop(out);
+    out.reset();
+    ASSERT_EQ(counter.use_count(), 5);
+  }
+  ASSERT_EQ(counter.use_count(), 1);
+  concurrent_stack<std::unique_ptr<int>> owners;
+  owners.emplace(new int(3));
+  std::unique_ptr<int> out;
+  ASSERT_TRUE(owners.try_pop(out));
+  ASSERT_EQ(*out, 3);
+}
+
+TEST(testConcurrentStack, chains) {
+  concurrent_stack<std::string> s;
+  std::vector<std::string> in{"a", "b", "c"};
+  s.push("z");
+  s.push_chain(in.begin(), in.end());
+  std::vector<std::string> out;
+  ASSERT_EQ(s.pop_all(std::back_inserter(out)), 4U);
+  ASSERT_EQ(out, (std::vector<std::string>{"c", "b", "a", "z"}));
+  ASSERT_TRUE(s.empty());
+  ASSERT_EQ(s.pop_all(std::back_inserter(out)), 0U);
+  s.push_chain(in.begin(), in.begin());
+  ASSERT_TRUE(s.empty());
+}
+
+TEST(testConcurrentStack, throwingCopyKeepsStack) {
+  struct fragile {
+    int value;
+    explicit fragile(int v) : value(v) {}
+    fragile(const fragile &other) : value(other.value) {
+      if (value == 3) throw std::runtime_error("copy");
+    }
+  };
+  concurrent_stack<fragile> s;
+  std::vector<fragile> in{fragile(1), fragile(2)};
+  in.emplace_back(3);
+  ASSERT_THROW(s.push_chain(in.begin(), in.end()), std::runtime_error);
+  ASSERT_TRUE(s.empty());
+  s.push_chain(in.begin(), in.begin() + 2);
+  ASSERT_THROW(s.push(in[2]), std::runtime_error);
+  std::vector<int> values;
+  struct sink {
+    std::vector<int> *values;
+    sink &operator*() { return *this; }
+    sink &operator++() { return *this; }
+    sink &operator=(const fragile &f) {
+      values->push_back(f.value);
+      return *this;
+    }
+  };
+  ASSERT_EQ(s.pop_all(sink{&values}), 2U);
+  ASSERT_EQ(values, (std::vector<int>{2, 1}));
+}
+
+// every pushed item is popped exactly once
+static void push_pop_threads(std::size_t elimination_slots) {
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 20000;
+  concurrent_stack<int> s(elimination_slots);
+  std::vector<std::atomic<int>> seen(kThreads * kPerThread);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      int out;
+      for (int i = 0; i < kPerThread; ++i) {
+        s.push(t * kPerThread + i);
+        if (i % 2 && s.try_pop(out)) ++seen[out];
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  std::vector<int> rest;
+  s.pop_all(std::back_inserter(rest));
+  for (int value : rest) ++seen[value];
+  for (auto &count : seen) ASSERT_EQ(count.load(), 1);
+}
+
+TEST(testConcurrentStack, threads) { push_pop_threads(0); }
+
+TEST(testConcurrentStack, threadsWithElimination) { push_pop_threads(4); }
+
+// failed chains hand their nodes back to the pool while poppers run
+TEST(testConcurrentStack, throwingChainWithPoppers) {
+  struct fragile {
+    int value;
+    explicit fragile(int v) : value(v) {}
+    fragile(const fragile &other) : value(other.value) {
+      if (value < 0) throw std::runtime_error("copy");
+    }
+    fragile &operator=(const fragile &) = default;
+  };
+  constexpr int kChains = 2000;
+  concurrent_stack<fragile> s;
+  std::atomic<bool> done{false};
+  std::atomic<long> popped{0};
+  std::vector<std::thread> poppers;
+  for (int t = 0; t < 2; ++t) {
+    poppers.emplace_back([&] {
+      fragile out(0);
+      while (!done.load() || !s.empty())
+        if (s.try_pop(out)) popped += out.value;
+    });
+  }
+  long pushed = 0;
+  for (int i = 0; i < kChains; ++i) {
+    std::vector<fragile> good{fragile(1), fragile(2), fragile(3)};
+    std::vector<fragile> bad{fragile(4), fragile(5)};
+    bad.emplace_back(-1);
+    s.push_chain(good.begin(), good.end());
+    pushed += 6;
+    ASSERT_THROW(s.push_chain(bad.begin(), bad.end()), std::runtime_error);
+  }
+  done = true;
+  for (auto &thread : poppers) thread.join();
+  ASSERT_TRUE(s.empty());
+  ASSERT_EQ(popped.load(), pushed);
+}
@@ -4,8 +4,11 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstring>
+#include <iterator>
 #include <map>
 #include <set>
+#include <sstream>
 #include <vector>
 
 #include "../s21_containers.h"
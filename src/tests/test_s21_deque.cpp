@@ -0,0 +1,169 @@
+#include "test_s21_containers.h"
+
+#include <deque>
+#include <string>
+
+namespace {
+
+struct counted {
+  static int live;
+  int value;
+  counted(int v) : value(v) { ++live; }
+  counted(const counted &other) : value(other.value) { ++live; }
+  ~counted() { --live; }
+};
+int counted::live = 0;
+
+}  // namespace
+
+TEST(testDeque, empty) {
+  s21::deque<int> d;
+  ASSERT_TRUE(d.empty());
+  ASSERT_EQ(d.size(), 0U);
+  ASSERT_TRUE(d.begin() == d.end());
+  ASSERT_THROW(d.front(), std::out_of_range);
+  ASSERT_THROW(d.back(), std::out_of_range);
+  ASSERT_THROW(d.pop_front(), std::out_of_range);
+  ASSERT_THROW(d.pop_back(), std::out_of_range);
+  ASSERT_THROW(d.at(0), std::out_of_range);
+}
+
+TEST(testDeque, block_size) {
+  ASSERT_EQ(s21::deque<char>::block_size, 4096U);
+  ASSERT_EQ(s21::deque<int>::block_size, 1024U);
+  ASSERT_EQ((s21::deque<std::array<char, 1000>>::block_size), 16U);
+}
+
+TEST(testDeque, push_both_ends) {
+  s21::deque<int> d;
+  std::deque<int> ref;
+  for (int i = 0; i < 5000; ++i) {
+    d.push_back(i);
+    ref.push_back(i);
+    d.push_front(-i);
+    ref.push_front(-i);
+  }
+  ASSERT_EQ(d.size(), ref.size());
+  ASSERT_EQ(d.front(), -4999);
+  ASSERT_EQ(d.back(), 4999);
+  for (std::size_t i = 0; i < ref.size(); ++i) ASSERT_EQ(d[i], ref[i]);
+  ASSERT_TRUE(std::equal(d.begin(), d.end(), ref.begin(), ref.end()));
+}
+
+TEST(testDeque, references_stay_valid) {
+  s21::deque<std::string> d{"middle"};
+  std::string *middle = &d.front();
+  for (int i = 0; i < 3000; ++i) {
+    d.push_back(std::to_string(i));
+    d.push_front(std::to_string(-i));
+  }
+  ASSERT_EQ(middle, &d[3000]);
+  ASSERT_EQ(*middle, "middle");
+  for (int i = 0; i < 2000; ++i) {
+    d.pop_back();
+    d.pop_front();
+  }
+  ASSERT_EQ(middle, &d[1000]);
+}
+
+TEST(testDeque, fifo_and_lifo) {
+  s21::deque<int> d;
+  for (int round = 0; round < 10; ++round) {
+    for (int i = 0; i < 3000; ++i) d.push_back(i);
+    for (int i = 0; i < 3000; ++i) {
+      ASSERT_EQ(d.front(), i);
+      d.pop_front();
+    }
+  }
+  ASSERT_TRUE(d.empty());
+  for (int i = 0; i < 3000; ++i) d.push_front(i);
+  for (int i = 0; i < 3000; ++i) {
+    ASSERT_EQ(d.front(), 2999 - i);
+    d.pop_front();
+  }
+  for (int i = 0; i < 3000; ++i) d.push_back(i);
+  for (int i = 2999; i >= 0; --i) {
+    ASSERT_EQ(d.back(), i);
+    d.pop_back();
+  }
+  ASSERT_TRUE(d.empty());
+}
+
+TEST(testDeque, fifo_steady_state_allocation_free) {
+  s21::deque<int, s21::tracking_allocator<int>> d;
+  const s21::allocation_stats &stats = d.get_allocator().stats();
+  for (int i = 0; i < 3000; ++i) d.push_back(i);
+  for (int i = 0; i < 9000; ++i) {
+    d.push_back(i % 3000);
+    d.pop_front();
+  }
+  // the head drifts through the map, which is rotated instead of replaced
+  const std::size_t warmed_up = stats.allocations();
+  for (int i = 0; i < 100000; ++i) {
+    ASSERT_EQ(d.front(), i % 3000);
+    d.push_back(i % 3000);
+    d.pop_front();
+  }
+  ASSERT_EQ(stats.allocations(), warmed_up);
+  ASSERT_EQ(d.size(), 3000U);
+}
+
+TEST(testDeque, random_access_iterator) {
+  s21::deque<int> d;
+  for (int i = 0; i < 3000; ++i) d.push_back(3000 - i);
+  auto it = d.begin() + 2500;
+  ASSERT_EQ(*it, 500);
+  ASSERT_EQ(it[-1000], 1500);
+  ASSERT_EQ(d.end() - it, 500);
+  ASSERT_TRUE(d.begin() < it);
+  std::sort(d.begin(), d.end());
+  ASSERT_TRUE(std::is_sorted(d.cbegin(), d.cend()));
+  ASSERT_EQ(d.front(), 1);
+  s21::deque<int>::const_iterator cit = d.begin() + 10;
+  ASSERT_EQ(*cit, 11);
+  ASSERT_EQ(std::distance(d.cbegin(), d.cend()), 3000);
+}
+
+TEST(testDeque, copy_move_and_swap) {
+  s21::deque<std::string> a{"a", "b", "c"};
+  s21::deque<std::string> b(a);
+  ASSERT_EQ(b.size(), 3U);
+  ASSERT_EQ(b.back(), "c");
+  b.push_front("z");
+  ASSERT_EQ(a.front(), "a");
+  s21::deque<std::string> c(std::move(b));
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(c.front(), "z");
+  b = c;
+  ASSERT_EQ(b.size(), 4U);
+  a.swap(b);
+  ASSERT_EQ(a.size(), 4U);
+  ASSERT_EQ(b.size(), 3U);
+  a = std::move(b);
+  ASSERT_EQ(a.size(), 3U);
+  a.insert_many_back("d", "e");
+  a.insert_many_front("y");
+  ASSERT_EQ(a.front(), "y");
+  ASSERT_EQ(a.back(), "e");
+  ASSERT_EQ(a.at(3), "c");
+}
+
+TEST(testDeque, clear_and_shrink) {
+  counted::live = 0;
+  {
+    s21::deque<counted> d;
+    for (int i = 0; i < 100; ++i) d.emplace_back(i);
+    for (int i = 0; i < 100; ++i) d.emplace_front(i);
+    ASSERT_EQ(counted::live, 200);
+    d.pop_front();
+    d.pop_back();
+    ASSERT_EQ(counted::live, 198);
+    d.clear();
+    ASSERT_EQ(counted::live, 0);
+    d.shrink_to_fit();
+    d.emplace_back(7);
+    ASSERT_EQ(d.front().value, 7);
+    ASSERT_EQ(counted::live, 1);
+  }
+  ASSERT_EQ(counted::live, 0);
+}
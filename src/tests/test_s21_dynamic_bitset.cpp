@@ -0,0 +1,155 @@
+#include "test_s21_containers.h"
+
+namespace {
+
+// reference model: one bool per bit
+s21::dynamic_bitset from_bools(const std::vector<bool> &bits) {
+  s21::dynamic_bitset b;
+  for (bool bit : bits) b.push_back(bit);
+  return b;
+}
+
+std::vector<bool> pattern(std::size_t n, std::size_t seed) {
+  std::vector<bool> bits(n);
+  for (std::size_t i = 0; i < n; ++i)
+    bits[i] = ((i * 2654435761u + seed) >> 7) % 3 == 0;
+  return bits;
+}
+
+void expect_equal(const s21::dynamic_bitset &b, const std::vector<bool> &r) {
+  ASSERT_EQ(b.size(), r.size());
+  for (std::size_t i = 0; i < r.size(); ++i) ASSERT_EQ(b[i], r[i]) << i;
+}
+
+}  // namespace
+
+TEST(testDynamicBitset, construct) {
+  s21::dynamic_bitset empty;
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.count(), 0U);
+  ASSERT_EQ(empty.find_first(), s21::dynamic_bitset::npos);
+  s21::dynamic_bitset ones(130, true);
+  ASSERT_EQ(ones.size(), 130U);
+  ASSERT_EQ(ones.num_words(), 3U);
+  ASSERT_EQ(ones.count(), 130U);
+  ASSERT_TRUE(ones.all());
+  // padding bits stay clear
+  ASSERT_EQ(ones.data()[2], 3U);
+  s21::dynamic_bitset list{true, false, true};
+  ASSERT_EQ(list.count(), 2U);
+  ASSERT_FALSE(list[1]);
+}
+
+TEST(testDynamicBitset, proxyReference) {
+  s21::dynamic_bitset b(70);
+  b[3] = true;
+  b[69] = b[3];
+  ASSERT_TRUE(b[69]);
+  ASSERT_FALSE(~b[69]);
+  b[3].flip();
+  ASSERT_FALSE(b.test(3));
+  ASSERT_THROW(b.test(70), std::out_of_range);
+  ASSERT_THROW(b.set(70), std::out_of_range);
+  b.set(5).reset(69).flip(6);
+  ASSERT_EQ(b.count(), 2U);
+  ASSERT_EQ(b.find_first(), 5U);
+  ASSERT_EQ(b.find_next(5), 6U);
+  ASSERT_EQ(b.find_next(6), s21::dynamic_bitset::npos);
+}
+
+TEST(testDynamicBitset, ranges) {
+  for (std::size_t pos : {0, 1, 63, 64, 65, 100}) {
+    for (std::size_t len : {0, 1, 62, 64, 65, 129, 200}) {
+      const std::size_t n = 333;
+      if (pos + len > n) continue;
+      std::vector<bool> ref = pattern(n, pos + len);
+      s21::dynamic_bitset b = from_bools(ref);
+      b.set(pos, len, true);
+      for (std::size_t i = pos; i < pos + len; ++i) ref[i] = true;
+      expect_equal(b, ref);
+      b.flip(pos, len);
+      for (std::size_t i = pos; i < pos + len; ++i) ref[i] = !ref[i];
+      expect_equal(b, ref);
+      b.flip(0, n);
+      b.reset(pos, len);
+      for (std::size_t i = 0; i < n; ++i) ref[i] = !ref[i];
+      for (std::size_t i = pos; i < pos + len; ++i) ref[i] = false;
+      expect_equal(b, ref);
+    }
+  }
+  s21::dynamic_bitset b(10);
+  ASSERT_THROW(b.set(5, 6, true), std::out_of_range);
+  b.set();
+  ASSERT_TRUE(b.all());
+  b.flip();
+  ASSERT_TRUE(b.none());
+}
+
+TEST(testDynamicBitset, countAndFind) {
+  for (std::size_t n : {1, 63, 64, 65, 255, 256, 257, 5000, 70000}) {
+    const std::vector<bool> ref = pattern(n, n);
+    const s21::dynamic_bitset b = from_bools(ref);
+    const auto ones = std::count(ref.begin(), ref.end(), true);
+    ASSERT_EQ(b.count(), static_cast<std::size_t>(ones));
+    std::size_t expected = 0;
+    while (expected < n && !ref[expected]) ++expected;
+    std::size_t pos = b.find_first();
+    for (; pos != s21::dynamic_bitset::npos; pos = b.find_next(pos)) {
+      ASSERT_EQ(pos, expected);
+      do {
+        ++expected;
+      } while (expected < n && !ref[expected]);
+    }
+    ASSERT_EQ(expected, n);
+  }
+}
+
+TEST(testDynamicBitset, bitwise) {
+  for (std::size_t n : {5, 64, 300, 4099}) {
+    const std::vector<bool> ra = pattern(n, 1), rb = pattern(n, 99);
+    const s21::dynamic_bitset a = from_bools(ra), b = from_bools(rb);
+    const s21::dynamic_bitset band = a & b, bor = a | b, bxor = a ^ b;
+    s21::dynamic_bitset bandnot = a;
+    bandnot.and_not(b);
+    const s21::dynamic_bitset inv = ~a;
+    for (std::size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(band[i], ra[i] && rb[i]);
+      ASSERT_EQ(bor[i], ra[i] || rb[i]);
+      ASSERT_EQ(bxor[i], ra[i] != rb[i]);
+      ASSERT_EQ(bandnot[i], ra[i] && !rb[i]);
+      ASSERT_EQ(inv[i], !ra[i]);
+    }
+    ASSERT_EQ(inv.count(), n - a.count());
+    ASSERT_EQ((a ^ a).count(), 0U);
+    ASSERT_TRUE((a | b) == (b | a));
+    ASSERT_TRUE(a != b);
+  }
+  s21::dynamic_bitset small(3), big(4);
+  ASSERT_THROW(small &= big, std::invalid_argument);
+}
+
+TEST(testDynamicBitset, resize) {
+  s21::dynamic_bitset b(60, true);
+  b.resize(130, false);
+  ASSERT_EQ(b.count(), 60U);
+  b.resize(200, true);
+  ASSERT_EQ(b.count(), 130U);
+  ASSERT_FALSE(b[100]);
+  ASSERT_TRUE(b[199]);
+  b.resize(10);
+  ASSERT_EQ(b.count(), 10U);
+  ASSERT_EQ(b.data()[0], 0x3ffU);
+  b.pop_back();
+  ASSERT_EQ(b.size(), 9U);
+  b.resize(64, true);
+  ASSERT_EQ(b.count(), 64U);
+  s21::dynamic_bitset other;
+  other.swap(b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(other.size(), 64U);
+  other.clear();
+  ASSERT_THROW(other.pop_back(), std::out_of_range);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(s21::dynamic_bitset(1000).data()) %
+                32,
+            0U);
+}
@@ -0,0 +1,157 @@
+#include "test_s21_containers.h"
+
+namespace {
+
+struct connection {
+  explicit connection(int id) : id(id) {}
+  int id;
+  s21::listNode_base by_activity;
+  s21::listNode_base by_owner;
+};
+
+using activity_list = s21::intrusive_list<connection, &connection::by_activity>;
+using owner_list = s21::intrusive_list<connection, &connection::by_owner>;
+
+template <typename L>
+std::vector<int> ids(const L &l) {
+  std::vector<int> forward, backward;
+  for (const auto &c : l) forward.push_back(c.id);
+  for (auto it = l.end(); it != l.begin();) backward.push_back((--it)->id);
+  std::reverse(backward.begin(), backward.end());
+  EXPECT_EQ(forward, backward);
+  return forward;
+}
+
+}  // namespace
+
+TEST(testIntrusiveList, empty) {
+  activity_list l;
+  ASSERT_TRUE(l.empty());
+  ASSERT_EQ(l.size(), 0U);
+  ASSERT_TRUE(l.begin() == l.end());
+  ASSERT_THROW(l.front(), std::out_of_range);
+  ASSERT_THROW(l.pop_back(), std::out_of_range);
+}
+
+TEST(testIntrusiveList, linkWithoutCopies) {
+  connection a(1), b(2), c(3);
+  activity_list l;
+  l.push_back(b);
+  l.push_front(a);
+  l.push_back(c);
+  ASSERT_EQ(ids(l), (std::vector<int>{1, 2, 3}));
+  ASSERT_EQ(&l.front(), &a);
+  ASSERT_EQ(&l.back(), &c);
+  ASSERT_TRUE(a.by_activity.is_linked());
+  ASSERT_FALSE(a.by_owner.is_linked());
+  l.front().id = 10;
+  ASSERT_EQ(a.id, 10);
+  l.pop_front();
+  ASSERT_FALSE(a.by_activity.is_linked());
+  ASSERT_EQ(ids(l), (std::vector<int>{2, 3}));
+}
+
+TEST(testIntrusiveList, selfUnlink) {
+  connection a(1), b(2), c(3);
+  activity_list l;
+  l.push_back(a);
+  l.push_back(b);
+  l.push_back(c);
+  b.by_activity.unlink();
+  ASSERT_FALSE(b.by_activity.is_linked());
+  ASSERT_EQ(ids(l), (std::vector<int>{1, 3}));
+  b.by_activity.unlink();
+  a.by_activity.unlink();
+  c.by_activity.unlink();
+  ASSERT_TRUE(l.empty());
+  l.push_back(b);
+  ASSERT_EQ(ids(l), std::vector<int>{2});
+}
+
+TEST(testIntrusiveList, severalLists) {
+  connection a(1), b(2), c(3);
+  activity_list active;
+  owner_list alice, bob;
+  active.push_back(a);
+  active.push_back(b);
+  active.push_back(c);
+  alice.push_back(a);
+  alice.push_back(c);
+  bob.push_back(b);
+  // most recently active to the front
+  active.splice(active.cbegin(), active, active.iterator_to(c));
+  ASSERT_EQ(ids(active), (std::vector<int>{3, 1, 2}));
+  ASSERT_EQ(ids(alice), (std::vector<int>{1, 3}));
+  alice.remove(c);
+  ASSERT_EQ(ids(alice), std::vector<int>{1});
+  ASSERT_EQ(ids(active), (std::vector<int>{3, 1, 2}));
+  bob.splice(bob.cend(), alice);
+  ASSERT_TRUE(alice.empty());
+  ASSERT_EQ(ids(bob), (std::vector<int>{2, 1}));
+}
+
+TEST(testIntrusiveList, eraseInsertAndClear) {
+  std::vector<connection> pool;
+  for (int i = 0; i < 6; ++i) pool.emplace_back(i);
+  activity_list l;
+  for (auto &c : pool) l.push_back(c);
+  for (auto it = l.begin(); it != l.end();)
+    it = it->id % 2 ? l.erase(it) : ++it;
+  ASSERT_EQ(ids(l), (std::vector<int>{0, 2, 4}));
+  auto it = l.insert(++l.cbegin(), pool[1]);
+  ASSERT_EQ(it->id, 1);
+  ASSERT_EQ(l.size(), 4U);
+  l.clear();
+  for (auto &c : pool) ASSERT_FALSE(c.by_activity.is_linked());
+}
+
+TEST(testIntrusiveList, moveAndDestroy) {
+  connection a(1), b(2);
+  {
+    activity_list l;
+    l.push_back(a);
+    l.push_back(b);
+    activity_list m(std::move(l));
+    ASSERT_TRUE(l.empty());
+    ASSERT_EQ(ids(m), (std::vector<int>{1, 2}));
+    activity_list n;
+    n = std::move(m);
+    ASSERT_EQ(ids(n), (std::vector<int>{1, 2}));
+  }
+  ASSERT_FALSE(a.by_activity.is_linked());
+  ASSERT_FALSE(b.by_activity.is_linked());
+  // a copy of an element does not inherit its place
+  activity_list l;
+  l.push_back(a);
+  connection copy = a;
+  ASSERT_FALSE(copy.by_activity.is_linked());
+  ASSERT_EQ(ids(l), std::vector<int>{1});
+}
+
+#ifndef NDEBUG
+TEST(testIntrusiveListDeathTest, doubleLink) {
+  connection a(1);
+  activity_list l, m;
+  l.push_back(a);
+  ASSERT_DEATH(m.push_back(a), "already linked");
+}
+
+TEST(testIntrusiveListDeathTest, destroyLinked) {
+  activity_list l;
+  ASSERT_DEATH(
+      {
+        connection a(1);
+        l.push_back(a);
+      },
+      "destroyed while linked");
+  // moving an element out leaves the linked original behind
+  ASSERT_DEATH(
+      {
+        auto a = std::make_unique<connection>(1);
+        l.push_back(*a);
+        connection moved = std::move(*a);
+        a.reset();
+      },
+      "destroyed while linked");
+}
+#endif
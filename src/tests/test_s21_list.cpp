@@ -41,6 +41,68 @@ TEST(testList, sort) {
   ASSERT_EQ(test_list.back(), 5);
 }
 
+// walks the list both ways, checking the prev links the sort rebuilt
+template <typename T>
+static std::vector<T> to_vector_checked(list<T> &l) {
+  std::vector<T> forward(l.begin(), l.end());
+  std::vector<T> backward;
+  for (auto it = l.end(); it != l.begin();) backward.push_back(*--it);
+  std::reverse(backward.begin(), backward.end());
+  EXPECT_EQ(forward, backward);
+  EXPECT_EQ(forward.size(), l.size());
+  return forward;
+}
+
+TEST(testList, sortOrders) {
+  for (int n : {0, 1, 2, 3, 7, 64, 1000, 1025}) {
+    list<int> sorted, reversed, random;
+    std::vector<int> expected;
+    unsigned x = 12345;
+    for (int i = 0; i < n; ++i) {
+      sorted.push_back(i);
+      reversed.push_front(i);
+      x = x * 1103515245 + 12345;
+      random.push_back(static_cast<int>(x >> 16) % 100);
+      expected.push_back(static_cast<int>(x >> 16) % 100);
+    }
+    std::sort(expected.begin(), expected.end());
+    sorted.sort();
+    reversed.sort();
+    random.sort();
+    std::vector<int> iota(n);
+    for (int i = 0; i < n; ++i) iota[i] = i;
+    ASSERT_EQ(to_vector_checked(sorted), iota);
+    ASSERT_EQ(to_vector_checked(reversed), iota);
+    ASSERT_EQ(to_vector_checked(random), expected);
+  }
+}
+
+TEST(testList, sortStableWithComparator) {
+  list<std::pair<int, int>> l;
+  for (int i = 0; i < 300; ++i) l.push_back({i % 7, i});
+  auto first = l.begin();
+  const std::pair<int, int> *first_value = &*first;
+  l.sort([](const auto &a, const auto &b) { return a.first > b.first; });
+  auto v = to_vector_checked(l);
+  for (std::size_t i = 1; i < v.size(); ++i) {
+    ASSERT_GE(v[i - 1].first, v[i].first);
+    if (v[i - 1].first == v[i].first) {
+      ASSERT_LT(v[i - 1].second, v[i].second);
+    }
+  }
+  // nodes are relinked, not copied
+  ASSERT_EQ(&*first, first_value);
+  ASSERT_EQ(*first, (std::pair<int, int>{0, 0}));
+}
+
+TEST(testList, mergeWithComparator) {
+  list<int> a{9, 7, 3, 3};
+  list<int> b{8, 3, 1};
+  a.merge(b, std::greater<>());
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(to_vector_checked(a), (std::vector<int>{9, 8, 7, 3, 3, 3, 1}));
+}
+
 TEST(testList, merge) {
   list<int> test_list1{1, 2, 3, 8, 9};
   list<int> test_list2{4, 5, 6, 7, 10};
@@ -81,6 +143,61 @@ TEST(testList, splice) {
   ASSERT_EQ(test_list1.back(), 18);
 }
 
+TEST(testList, spliceWholeKeepsNodes) {
+  list<int> a{1, 2, 3};
+  list<int> b{4, 5};
+  const int *four = &*b.begin();
+  a.splice(++a.cbegin(), b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(to_vector_checked(a), (std::vector<int>{1, 4, 5, 2, 3}));
+  ASSERT_EQ(&*++a.begin(), four);
+  ASSERT_EQ(to_vector_checked(b), std::vector<int>{});
+  b.splice(b.cend(), a);
+  ASSERT_EQ(to_vector_checked(b), (std::vector<int>{1, 4, 5, 2, 3}));
+  a.splice(a.cend(), a);
+  ASSERT_TRUE(a.empty());
+}
+
+TEST(testList, spliceOne) {
+  list<int> a{1, 2, 3, 4};
+  list<int> b{10, 20};
+  // move to front, as in an LRU list
+  a.splice(a.cbegin(), a, --a.cend());
+  ASSERT_EQ(to_vector_checked(a), (std::vector<int>{4, 1, 2, 3}));
+  a.splice(a.cbegin(), a, a.cbegin());
+  a.splice(++a.cbegin(), a, a.cbegin());
+  ASSERT_EQ(to_vector_checked(a), (std::vector<int>{4, 1, 2, 3}));
+  a.splice(a.cend(), b, b.cbegin());
+  ASSERT_EQ(to_vector_checked(a), (std::vector<int>{4, 1, 2, 3, 10}));
+  ASSERT_EQ(to_vector_checked(b), (std::vector<int>{20}));
+  a.splice(a.cbegin(), b, b.cbegin());
+  ASSERT_EQ(a.size(), 6U);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(a.front(), 20);
+}
+
+TEST(testList, spliceRange) {
+  list<int> a{1, 2, 3, 4, 5, 6};
+  list<int> b{10, 20, 30, 40};
+  auto first = ++b.cbegin();
+  auto last = --b.cend();
+  a.splice(++a.cbegin(), b, first, last);
+  ASSERT_EQ(to_vector_checked(a), (std::vector<int>{1, 20, 30, 2, 3, 4, 5, 6}));
+  ASSERT_EQ(to_vector_checked(b), (std::vector<int>{10, 40}));
+  // within one list: move [2, 4] to the end
+  auto from = a.cbegin();
+  for (int i = 0; i < 3; ++i) ++from;
+  auto to = from;
+  for (int i = 0; i < 3; ++i) ++to;
+  a.splice(a.cend(), a, from, to);
+  ASSERT_EQ(to_vector_checked(a), (std::vector<int>{1, 20, 30, 5, 6, 2, 3, 4}));
+  a.splice(a.cbegin(), a, a.cbegin(), a.cbegin());
+  b.splice(b.cend(), a, a.cbegin(), a.cend());
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(b.size(), 10U);
+  ASSERT_EQ(b.back(), 4);
+}
+
 TEST(testList, copyAssigment) {
   list<int> test_list1{1, 2, 3, 4, 5, 6, 7, 8, 9};
   list<int> test_list2{10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
@@ -182,3 +299,112 @@ TEST(testList, constructors) {
   ASSERT_EQ(test_list4.front(), 10);
   ASSERT_EQ(test_list4.back(), 12);
 }
+
+namespace {
+struct copy_counted {
+  static int copies;
+  int value;
+  copy_counted(int v) : value(v) {}
+  copy_counted(const copy_counted &other) : value(other.value) { ++copies; }
+  copy_counted(copy_counted &&other) noexcept : value(other.value) {}
+  copy_counted &operator=(const copy_counted &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  copy_counted &operator=(copy_counted &&) noexcept = default;
+};
+int copy_counted::copies = 0;
+
+struct throwing_ctor {
+  throwing_ctor(int v) {
+    if (v < 0) throw std::invalid_argument("negative");
+  }
+};
+}  // namespace
+
+TEST(testList, swapWithEmpty) {
+  list<int> a{1, 2, 3};
+  list<int> b;
+  a.swap(b);
+  ASSERT_TRUE(a.empty());
+  ASSERT_TRUE(a.begin() == a.end());
+  ASSERT_EQ(to_vector_checked(b), (std::vector<int>{1, 2, 3}));
+  a.swap(b);
+  ASSERT_EQ(to_vector_checked(a), (std::vector<int>{1, 2, 3}));
+  ASSERT_TRUE(b.begin() == b.end());
+  list<int> c, d;
+  c.swap(d);
+  ASSERT_TRUE(c.begin() == c.end());
+  c.push_back(1);
+  ASSERT_EQ(to_vector_checked(c), std::vector<int>{1});
+}
+
+TEST(testList, moveStealsNodes) {
+  list<copy_counted> a;
+  for (int i = 0; i < 100; ++i) a.emplace_back(i);
+  const copy_counted *first = &*a.begin();
+  copy_counted::copies = 0;
+  list<copy_counted> b(std::move(a));
+  ASSERT_EQ(copy_counted::copies, 0);
+  ASSERT_EQ(b.size(), 100U);
+  ASSERT_EQ(&*b.begin(), first);
+  ASSERT_TRUE(a.empty());
+  ASSERT_TRUE(a.begin() == a.end());
+  list<copy_counted> c{1, 2};
+  copy_counted::copies = 0;
+  c = std::move(b);
+  ASSERT_EQ(copy_counted::copies, 0);
+  ASSERT_EQ(c.size(), 100U);
+  ASSERT_EQ(c.back().value, 99);
+  auto make = [] {
+    list<copy_counted> l;
+    l.emplace_back(7);
+    return l;
+  };
+  copy_counted::copies = 0;
+  list<copy_counted> d = make();
+  ASSERT_EQ(copy_counted::copies, 0);
+  ASSERT_EQ(d.front().value, 7);
+}
+
+TEST(testList, emplaceAndRvalues) {
+  list<std::unique_ptr<int>> l;
+  l.push_back(std::make_unique<int>(2));
+  l.push_front(std::make_unique<int>(1));
+  ASSERT_EQ(*l.emplace_back(new int(4)), 4);
+  auto it = l.emplace(--l.cend(), new int(3));
+  ASSERT_EQ(**it, 3);
+  ASSERT_EQ(l.emplace_front(), nullptr);
+  l.pop_front();
+  l.insert(l.end(), std::make_unique<int>(5));
+  std::vector<int> values;
+  for (auto &p : l) values.push_back(*p);
+  ASSERT_EQ(values, (std::vector<int>{1, 2, 3, 4, 5}));
+
+  list<std::pair<int, std::string>> pairs;
+  pairs.emplace_back(1, "one");
+  ASSERT_EQ(pairs.front().second, "one");
+}
+
+TEST(testList, emplaceThrows) {
+  list<throwing_ctor> l;
+  l.emplace_back(1);
+  ASSERT_THROW(l.emplace_back(-1), std::invalid_argument);
+  ASSERT_EQ(l.size(), 1U);
+  ASSERT_THROW(l.insert_many_back(2, -2), std::invalid_argument);
+  ASSERT_EQ(l.size(), 2U);
+}
+
+TEST(testList, insertManyForwards) {
+  list<copy_counted> l;
+  copy_counted::copies = 0;
+  l.insert_many_back(1, copy_counted(2), 3);
+  copy_counted four(4);
+  auto it = l.insert_many(l.cbegin(), std::move(four), 5);
+  ASSERT_EQ(copy_counted::copies, 0);
+  ASSERT_EQ(it->value, 5);
+  std::vector<int> values;
+  for (auto &x : l) values.push_back(x.value);
+  ASSERT_EQ(values, (std::vector<int>{4, 5, 1, 2, 3}));
+}
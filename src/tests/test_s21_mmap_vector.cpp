@@ -0,0 +1,161 @@
+#include "test_s21_containers.h"
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace {
+
+struct record {
+  std::int64_t id;
+  double value;
+};
+
+// unique file under /tmp, removed at the end of the test
+class temp_file {
+ public:
+  temp_file() {
+    static int counter = 0;
+    path_ = "/tmp/s21_mmap_vector_" + std::to_string(getpid()) + "_" +
+            std::to_string(counter++);
+  }
+  ~temp_file() { std::remove(path_.c_str()); }
+  const std::string &path() const { return path_; }
+  std::size_t bytes() const {
+    std::ifstream in(path_, std::ios::binary | std::ios::ate);
+    return static_cast<std::size_t>(in.tellg());
+  }
+
+ private:
+  std::string path_;
+};
+
+}  // namespace
+
+TEST(testMmapVector, createGrowAndReopen) {
+  temp_file file;
+  {
+    s21::mmap_vector<record> v(file.path(), s21::mmap_mode::create);
+    ASSERT_TRUE(v.is_open());
+    ASSERT_TRUE(v.writable());
+    ASSERT_TRUE(v.empty());
+    for (int i = 0; i < 10000; ++i) v.push_back({i, i * 0.5});
+    ASSERT_EQ(v.size(), 10000U);
+    ASSERT_GE(v.capacity(), 10000U);
+    ASSERT_EQ(file.bytes(), v.capacity() * sizeof(record));
+    v.sync();
+  }
+  // closing cut the file down to the elements
+  ASSERT_EQ(file.bytes(), 10000 * sizeof(record));
+
+  const s21::mmap_vector<record> ro(file.path());
+  ASSERT_FALSE(ro.writable());
+  ASSERT_EQ(ro.size(), 10000U);
+  ASSERT_EQ(ro.capacity(), 10000U);
+  ASSERT_EQ(ro[1234].id, 1234);
+  ASSERT_EQ(ro.at(9999).value, 9999 * 0.5);
+  ASSERT_THROW(ro.at(10000), std::out_of_range);
+  std::int64_t sum = 0;
+  for (const record &r : ro) sum += r.id;
+  ASSERT_EQ(sum, 9999LL * 10000 / 2);
+}
+
+TEST(testMmapVector, readWrite) {
+  temp_file file;
+  {
+    s21::mmap_vector<int> v(file.path(), s21::mmap_mode::create);
+    v.resize(100);
+    ASSERT_EQ(v[50], 0);
+    for (int i = 0; i < 100; ++i) v[i] = i;
+  }
+  {
+    s21::mmap_vector<int> v(file.path(), s21::mmap_mode::read_write);
+    ASSERT_EQ(v.size(), 100U);
+    v.push_back(v.front());  // argument lives in the mapping
+    v.pop_back();
+    v.push_back(v.back());
+    v[0] = -1;
+    v.shrink_to_fit();
+    ASSERT_EQ(v.capacity(), 101U);
+    ASSERT_EQ(v.back(), 99);
+  }
+  s21::mmap_vector<int> v(file.path());
+  ASSERT_EQ(v.size(), 101U);
+  ASSERT_EQ(v[0], -1);
+  ASSERT_EQ(v[100], 99);
+  ASSERT_TRUE(std::is_sorted(v.begin() + 1, v.end()));
+}
+
+TEST(testMmapVector, readOnlyRejectsGrowth) {
+  temp_file file;
+  { s21::mmap_vector<int> v(file.path(), s21::mmap_mode::create); }
+  s21::mmap_vector<int> v(file.path());
+  ASSERT_TRUE(v.empty());
+  ASSERT_EQ(v.data(), nullptr);
+  ASSERT_THROW(v.push_back(1), std::runtime_error);
+  ASSERT_THROW(v.reserve(10), std::runtime_error);
+  ASSERT_THROW(v.clear(), std::runtime_error);
+  v.sync();
+  v.advise(s21::access_hint::sequential);
+}
+
+TEST(testMmapVector, readOnlyCopyOnWrite) {
+  temp_file file;
+  {
+    s21::mmap_vector<int> v(file.path(), s21::mmap_mode::create);
+    for (int i = 0; i < 10; ++i) v.push_back(i);
+  }
+  {
+    s21::mmap_vector<int> v(file.path());
+    ASSERT_FALSE(v.writable());
+    // writes land in private pages
+    v[0] = 100;
+    v.back() = -9;
+    *v.data() += 1;
+    ASSERT_EQ(v.front(), 101);
+    ASSERT_EQ(v[9], -9);
+    const s21::mmap_vector<int> &cv = v;
+    ASSERT_EQ(cv.front(), 101);
+    ASSERT_EQ(cv.back(), -9);
+    v.sync();
+  }
+  const s21::mmap_vector<int> v(file.path());
+  ASSERT_EQ(v.front(), 0);
+  ASSERT_EQ(v.back(), 9);
+  ASSERT_EQ(file.bytes(), 10 * sizeof(int));
+}
+
+TEST(testMmapVector, errors) {
+  ASSERT_THROW(s21::mmap_vector<int>("/nonexistent/dir/file"),
+               std::system_error);
+  temp_file file;
+  {
+    std::ofstream out(file.path(), std::ios::binary);
+    out << "12345";  // not a whole number of ints
+  }
+  ASSERT_THROW(s21::mmap_vector<int>{file.path()}, std::runtime_error);
+  s21::mmap_vector<int> closed;
+  ASSERT_FALSE(closed.is_open());
+  ASSERT_THROW(closed.push_back(1), std::runtime_error);
+}
+
+TEST(testMmapVector, adviseAndMove) {
+  temp_file file;
+  s21::mmap_vector<std::uint8_t> v(file.path(), s21::mmap_mode::create);
+  v.resize(3 * 4096 + 17);
+  v.advise(s21::access_hint::random);
+  v.advise(s21::access_hint::will_need, 4097, 5000);
+  v.advise(s21::access_hint::normal, 100000);
+  v[4097] = 7;
+  s21::mmap_vector<std::uint8_t> moved(std::move(v));
+  ASSERT_FALSE(v.is_open());
+  ASSERT_EQ(moved[4097], 7);
+  v = std::move(moved);
+  ASSERT_EQ(v.size(), 3U * 4096 + 17);
+  v.sync(false);
+  v.close();
+  ASSERT_EQ(file.bytes(), 3U * 4096 + 17);
+  ASSERT_FALSE(v.is_open());
+}
@@ -0,0 +1,113 @@
+#include "test_s21_containers.h"
+
+#include <atomic>
+#include <iterator>
+#include <thread>
+
+using s21::mpmc_queue;
+
+TEST(testMpmcQueue, singleThread) {
+  mpmc_queue<int> q(5);
+  ASSERT_EQ(q.capacity(), 8U);
+  for (int i = 0; i < 8; ++i) ASSERT_TRUE(q.try_push(i));
+  ASSERT_FALSE(q.try_push(8));
+  ASSERT_EQ(q.size(), 8U);
+  int out = -1;
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(q.try_pop(out));
+    ASSERT_EQ(out, i);
+    ASSERT_TRUE(q.try_push(i + 8));
+  }
+  for (int i = 0; i < 8; ++i) ASSERT_EQ(q.pop(), 100 + i);
+  ASSERT_FALSE(q.try_pop(out));
+  ASSERT_TRUE(q.empty());
+  ASSERT_THROW(mpmc_queue<int>(0), std::length_error);
+}
+
+TEST(testMpmcQueue, moveOnlyAndLeftovers) {
+  auto counter = std::make_shared<int>(0);
+  {
+    mpmc_queue<std::shared_ptr<int>> q(4);
+    q.push(counter);
+    q.emplace(counter);
+    ASSERT_TRUE(q.try_emplace(counter));
+    ASSERT_EQ(counter.use_count(), 4);
+    q.pop();
+    ASSERT_EQ(counter.use_count(), 3);
+  }
+  ASSERT_EQ(counter.use_count(), 1);
+  mpmc_queue<std::unique_ptr<int>> owners(2);
+  owners.push(std::make_unique<int>(7));
+  std::unique_ptr<int> out;
+  owners.pop(out);
+  ASSERT_EQ(*out, 7);
+}
+
+TEST(testMpmcQueue, bulk) {
+  mpmc_queue<std::string> q(8);
+  std::vector<std::string> in{"a", "b", "c", "d", "e", "f", "g", "h", "i"};
+  ASSERT_EQ(q.try_push_bulk(in.begin(), 3), 3U);
+  ASSERT_EQ(q.try_push_bulk(std::make_move_iterator(in.begin() + 3), 6), 5U);
+  ASSERT_TRUE(in[3].empty());
+  std::vector<std::string> out;
+  ASSERT_EQ(q.try_pop_bulk(std::back_inserter(out), 6), 6U);
+  ASSERT_EQ(q.try_push_bulk(in.begin() + 8, 1), 1U);
+  ASSERT_EQ(q.try_pop_bulk(std::back_inserter(out), 100), 3U);
+  ASSERT_EQ(out, (std::vector<std::string>{"a", "b", "c", "d", "e", "f", "g",
+                                           "h", "i"}));
+  ASSERT_EQ(q.try_pop_bulk(std::back_inserter(out), 4), 0U);
+}
+
+TEST(testMpmcQueue, manyThreads) {
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 20000;
+  mpmc_queue<int> q(16);
+  std::atomic<long long> sum{0};
+  std::atomic<int> count{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < kPerThread; ++i) {
+        const int value = t * kPerThread + i;
+        if (i % 2)
+          q.push(value);
+        else
+          while (q.try_push_bulk(&value, 1) == 0) std::this_thread::yield();
+      }
+    });
+    threads.emplace_back([&, t] {
+      int batch[4];
+      for (int got = 0; got < kPerThread;) {
+        if (t % 2) {
+          const int value = q.pop();
+          sum += value;
+          ++got;
+        } else {
+          const int n = static_cast<int>(
+              q.try_pop_bulk(batch, std::min(4, kPerThread - got)));
+          for (int k = 0; k < n; ++k) sum += batch[k];
+          got += n;
+          if (n == 0) std::this_thread::yield();
+        }
+      }
+      count += kPerThread;
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  const long long total = kThreads * kPerThread;
+  ASSERT_EQ(count, total);
+  ASSERT_EQ(sum, total * (total - 1) / 2);
+  ASSERT_TRUE(q.empty());
+}
+
+TEST(testMpmcQueue, parkedProducersWake) {
+  mpmc_queue<int> q(1);
+  ASSERT_EQ(q.capacity(), 2U);
+  q.push(0);
+  std::thread producer([&] {
+    for (int i = 1; i <= 100; ++i) q.push(i);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  for (int i = 0; i <= 100; ++i) ASSERT_EQ(q.pop(), i);
+  producer.join();
+}
@@ -0,0 +1,82 @@
+#include "test_s21_containers.h"
+
+#include <random>
+
+namespace {
+
+struct record {
+  int key;
+  int seq;
+  bool operator<(const record &other) const { return key < other.key; }
+};
+
+s21::vector<int> random_ints(std::size_t n, int mod) {
+  std::mt19937 gen(42);
+  s21::vector<int> v;
+  for (std::size_t i = 0; i < n; ++i)
+    v.push_back(static_cast<int>(gen() % mod));
+  return v;
+}
+
+}  // namespace
+
+TEST(testParallelSort, matchesStdSort) {
+  for (unsigned threads : {1u, 2u, 3u, 4u, 7u, 16u}) {
+    auto v = random_ints(100003, 1000000);
+    std::vector<int> ref(v.begin(), v.end());
+    std::sort(ref.begin(), ref.end());
+    s21::parallel_sort(v, std::less<int>(), {threads, 1000});
+    ASSERT_TRUE(std::equal(ref.begin(), ref.end(), v.begin()));
+  }
+}
+
+TEST(testParallelSort, comparatorAndSmallInputs) {
+  for (std::size_t n : {0, 1, 2, 5, 17, 4096}) {
+    auto v = random_ints(n, 100);
+    s21::parallel_sort(v, std::greater<int>(), {4, 2});
+    ASSERT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<int>()));
+    ASSERT_EQ(v.size(), n);
+  }
+}
+
+TEST(testParallelSort, stable) {
+  std::mt19937 gen(7);
+  s21::vector<record> v;
+  for (int i = 0; i < 50000; ++i)
+    v.push_back({static_cast<int>(gen() % 64), i});
+  s21::parallel_stable_sort(v, std::less<record>(), {5, 100});
+  for (std::size_t i = 1; i < v.size(); ++i) {
+    ASSERT_LE(v[i - 1].key, v[i].key);
+    if (v[i - 1].key == v[i].key) {
+      ASSERT_LT(v[i - 1].seq, v[i].seq);
+    }
+  }
+}
+
+TEST(testParallelSort, nonTrivialElements) {
+  s21::vector<std::string> v;
+  for (int i = 0; i < 3000; ++i)
+    v.push_back(std::to_string((i * 7919) % 3001));
+  s21::parallel_sort(v, std::less<std::string>(), {4, 64});
+  ASSERT_TRUE(std::is_sorted(v.begin(), v.end()));
+  ASSERT_EQ(v.size(), 3000);
+}
+
+TEST(testParallelSort, array) {
+  s21::array<int, 9> a = {5, 3, 9, 1, 7, 2, 8, 6, 4};
+  s21::parallel_sort(a, std::less<int>(), {3, 2});
+  for (int i = 0; i < 9; ++i) ASSERT_EQ(a[i], i + 1);
+  s21::parallel_stable_sort(a, std::greater<int>(), {2, 2});
+  ASSERT_EQ(a[0], 9);
+  ASSERT_EQ(a[8], 1);
+}
+
+TEST(testParallelSort, exception) {
+  auto v = random_ints(10000, 1000);
+  auto throwing = [](int a, int b) {
+    if (a == 999 || b == 999) throw std::runtime_error("comparator");
+    return a < b;
+  };
+  v.push_back(999);
+  ASSERT_THROW(s21::parallel_sort(v, throwing, {4, 100}), std::runtime_error);
+}
@@ -0,0 +1,131 @@
+#include "test_s21_containers.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <set>
+
+using s21::priority_queue;
+
+namespace {
+
+std::vector<int> random_values(std::size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+  std::vector<int> values(n);
+  for (auto &v : values) v = dist(gen);
+  return values;
+}
+
+template <typename PQ>
+std::vector<int> drain(PQ &pq) {
+  std::vector<int> out;
+  while (!pq.empty()) {
+    out.push_back(pq.top());
+    pq.pop();
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(testPriorityQueue, empty) {
+  priority_queue<int> pq;
+  ASSERT_TRUE(pq.empty());
+  ASSERT_EQ(pq.size(), 0U);
+  ASSERT_THROW(pq.top(), std::out_of_range);
+  ASSERT_THROW(pq.pop(), std::out_of_range);
+}
+
+TEST(testPriorityQueue, popsInDescendingOrder) {
+  for (std::size_t n : {1U, 2U, 5U, 17U, 1000U}) {
+    std::vector<int> values = random_values(n, unsigned(n));
+    priority_queue<int> pq;
+    for (int v : values) pq.push(v);
+    ASSERT_EQ(pq.size(), n);
+    std::sort(values.begin(), values.end(), std::greater<int>());
+    ASSERT_EQ(drain(pq), values);
+  }
+}
+
+TEST(testPriorityQueue, greaterIsMinHeap) {
+  priority_queue<int, s21::vector<int>, std::greater<int>> pq = {5, 1, 4, 2,
+                                                                 3};
+  ASSERT_EQ(pq.top(), 1);
+  ASSERT_EQ(drain(pq), std::vector<int>({1, 2, 3, 4, 5}));
+}
+
+TEST(testPriorityQueue, heapifyConstructors) {
+  std::vector<int> values = random_values(777, 7);
+  priority_queue<int> from_range(values.begin(), values.end());
+  s21::vector<int> cont;
+  for (int v : values) cont.push_back(v);
+  priority_queue<int> from_container(std::less<int>(), std::move(cont));
+
+  std::sort(values.begin(), values.end(), std::greater<int>());
+  ASSERT_EQ(drain(from_range), values);
+  ASSERT_EQ(drain(from_container), values);
+}
+
+TEST(testPriorityQueue, pushBulk) {
+  std::vector<int> values = random_values(600, 3);
+  priority_queue<int> pq;
+  // small batches sift each element up, a large one heapifies
+  pq.push_bulk(values.begin(), values.begin() + 100);
+  for (std::size_t i = 100; i < 500; i += 10)
+    pq.push_bulk(values.begin() + i, values.begin() + i + 10);
+  pq.push_bulk(values.begin() + 500, values.end());
+  pq.push_bulk(values.end(), values.end());
+  ASSERT_EQ(pq.size(), values.size());
+
+  std::sort(values.begin(), values.end(), std::greater<int>());
+  ASSERT_EQ(drain(pq), values);
+}
+
+TEST(testPriorityQueue, interleaved) {
+  std::vector<int> values = random_values(2000, 11);
+  priority_queue<int> pq;
+  std::multiset<int> ref;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    pq.push(values[i]);
+    ref.insert(values[i]);
+    if (i % 3 == 2) {
+      ASSERT_EQ(pq.top(), *ref.rbegin());
+      pq.pop();
+      ref.erase(std::prev(ref.end()));
+    }
+  }
+  ASSERT_EQ(pq.size(), ref.size());
+}
+
+TEST(testPriorityQueue, moveOnlyAndEmplace) {
+  struct by_value {
+    bool operator()(const std::unique_ptr<int> &a,
+                    const std::unique_ptr<int> &b) const {
+      return *a < *b;
+    }
+  };
+  priority_queue<std::unique_ptr<int>, s21::vector<std::unique_ptr<int>>,
+                 by_value>
+      pq;
+  for (int v : {3, 9, 1, 7}) pq.push(std::make_unique<int>(v));
+  pq.emplace(new int(5));
+  ASSERT_EQ(*pq.top(), 9);
+  pq.pop();
+  ASSERT_EQ(*pq.top(), 7);
+  ASSERT_EQ(pq.size(), 4U);
+}
+
+TEST(testPriorityQueue, copySwapAndOtherContainers) {
+  priority_queue<int> a = {1, 2, 3};
+  priority_queue<int> b = a;
+  priority_queue<int> c;
+  c.swap(b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(c.top(), 3);
+  ASSERT_EQ(a.size(), 3U);
+
+  priority_queue<int, s21::deque<int>> d = {4, 8, 6};
+  ASSERT_EQ(drain(d), std::vector<int>({8, 6, 4}));
+}
@@ -2,8 +2,6 @@
 
 #ifdef GCOV
 template class s21::queue<int>;
-template class s21::QueueNode<int>;
-template class s21::QueueIterator_base<int, false>;
 #endif
 
 using s21::queue;
@@ -126,4 +124,52 @@ TEST(testQueue, insert_many_back) {
   EXPECT_EQ(q.size(), 6);
   EXPECT_EQ(q.front(), 10);
   EXPECT_EQ(q.back(), 1346);
-}
\ No newline at end of file
+}
+TEST(testQueue, ringBufferStorage) {
+  queue<std::unique_ptr<int>> q;
+  for (int i = 0; i < 100; ++i) {
+    q.push(std::make_unique<int>(i));
+    q.emplace(new int(-i));
+    q.pop();
+  }
+  ASSERT_EQ(q.size(), 100U);
+  ASSERT_EQ(*q.front(), 50);
+  ASSERT_EQ(*q.back(), -99);
+  int k = 100;
+  for (auto &p : q) {
+    ASSERT_EQ(*p, k % 2 ? -(k / 2) : k / 2);
+    ++k;
+  }
+}
+
+TEST(testQueue, otherContainers) {
+  queue<int, s21::list<int>> by_list{1, 2, 3};
+  queue<int, s21::deque<int>> by_deque{1, 2, 3};
+  by_list.pop();
+  by_deque.pop();
+  by_list.insert_many_back(4, 5);
+  by_deque.insert_many_back(4, 5);
+  ASSERT_EQ(std::vector<int>(by_list.begin(), by_list.end()),
+            std::vector<int>(by_deque.begin(), by_deque.end()));
+  ASSERT_EQ(by_list.front(), 2);
+  ASSERT_EQ(by_deque.back(), 5);
+  const auto &cq = by_deque;
+  ASSERT_EQ(cq.front(), 2);
+  queue<int, s21::ring_buffer<int>> wrapped(s21::ring_buffer<int>{7, 8});
+  ASSERT_EQ(wrapped.front(), 7);
+}
+
+TEST(testQueue, vectorAndUnrolledList) {
+  queue<int, s21::vector<int>> by_vector{1, 2, 3};
+  queue<int, s21::unrolled_list<int>> by_chunks{1, 2, 3};
+  by_vector.pop();
+  by_chunks.pop();
+  by_vector.insert_many_back(4);
+  by_chunks.insert_many_back(4);
+  ASSERT_EQ(std::vector<int>(by_vector.begin(), by_vector.end()),
+            (std::vector<int>{2, 3, 4}));
+  ASSERT_EQ(std::vector<int>(by_chunks.begin(), by_chunks.end()),
+            (std::vector<int>{2, 3, 4}));
+  ASSERT_EQ(by_vector.front(), 2);
+  ASSERT_EQ(by_chunks.back(), 4);
+}
@@ -0,0 +1,135 @@
+#include "test_s21_containers.h"
+
+#include <numeric>
+#include <string>
+
+using s21::ring_buffer;
+
+TEST(testRingBuffer, empty) {
+  ring_buffer<int> r;
+  ASSERT_TRUE(r.empty());
+  ASSERT_TRUE(r.full());
+  ASSERT_EQ(r.capacity(), 0U);
+  ASSERT_TRUE(r.begin() == r.end());
+  ASSERT_THROW(r.front(), std::out_of_range);
+  ASSERT_THROW(r.back(), std::out_of_range);
+  ASSERT_THROW(r.pop_front(), std::out_of_range);
+  ASSERT_THROW(r.pop_back(), std::out_of_range);
+  ASSERT_THROW(r.at(0), std::out_of_range);
+}
+
+TEST(testRingBuffer, fifoWrapsWithoutGrowing) {
+  ring_buffer<int> r;
+  for (int i = 0; i < 8; ++i) r.push_back(i);
+  ASSERT_EQ(r.capacity(), 8U);
+  const int *block = &r[0];
+  for (int i = 8; i < 1000; ++i) {
+    ASSERT_EQ(r.front(), i - 8);
+    r.pop_front();
+    r.push_back(i);
+  }
+  ASSERT_EQ(r.capacity(), 8U);
+  ASSERT_EQ(&r.front() - block < 8, true);
+  std::vector<int> expected(8);
+  std::iota(expected.begin(), expected.end(), 992);
+  ASSERT_EQ(std::vector<int>(r.begin(), r.end()), expected);
+}
+
+TEST(testRingBuffer, growthUnwraps) {
+  ring_buffer<int> r;
+  for (int i = 0; i < 8; ++i) r.push_back(i);
+  for (int i = 0; i < 5; ++i) {
+    r.pop_front();
+    r.push_back(8 + i);
+  }
+  // wrapped: the ring now starts at slot 5
+  r.push_back(13);
+  ASSERT_EQ(r.capacity(), 16U);
+  ASSERT_EQ(&r[0], &*r.begin());
+  for (std::size_t i = 0; i < r.size(); ++i) ASSERT_EQ(r[i], int(5 + i));
+  // contiguous from slot 0 after the move
+  ASSERT_EQ(&r[8] - &r[0], 8);
+}
+
+TEST(testRingBuffer, bothEnds) {
+  ring_buffer<std::string> r;
+  for (int i = 0; i < 20; ++i) {
+    r.push_back(std::to_string(i));
+    r.push_front(std::to_string(-i));
+  }
+  ASSERT_EQ(r.size(), 40U);
+  ASSERT_EQ(r.front(), "-19");
+  ASSERT_EQ(r.back(), "19");
+  ASSERT_EQ(r[19], "0");
+  ASSERT_EQ(r[20], "0");
+  r.pop_back();
+  r.pop_front();
+  ASSERT_EQ(r.front(), "-18");
+  ASSERT_EQ(r.back(), "18");
+}
+
+TEST(testRingBuffer, aliasingPushWhileGrowing) {
+  ring_buffer<std::string> r;
+  for (int i = 0; i < 8; ++i) r.push_back(std::string(32, 'a' + i));
+  r.push_back(r.front());
+  r.push_front(r.back());
+  ASSERT_EQ(r.back(), std::string(32, 'a'));
+  ASSERT_EQ(r.front(), std::string(32, 'a'));
+  ASSERT_EQ(r.size(), 10U);
+}
+
+TEST(testRingBuffer, fixedCapacity) {
+  ring_buffer<int> r(s21::fixed_capacity, 5);
+  ASSERT_TRUE(r.fixed());
+  ASSERT_EQ(r.capacity(), 5U);
+  for (int i = 0; i < 5; ++i) r.push_back(i);
+  ASSERT_TRUE(r.full());
+  ASSERT_THROW(r.push_back(5), std::length_error);
+  ASSERT_THROW(r.push_front(5), std::length_error);
+  ASSERT_THROW(r.reserve(6), std::length_error);
+  ASSERT_EQ(r.size(), 5U);
+  r.pop_front();
+  r.push_back(5);
+  ASSERT_EQ(r.front(), 1);
+  ASSERT_EQ(r.back(), 5);
+  ring_buffer<int> copy(r);
+  ASSERT_TRUE(copy.fixed());
+  ASSERT_THROW(copy.push_back(6), std::length_error);
+  ASSERT_THROW((ring_buffer<int>(s21::fixed_capacity, 0)), std::length_error);
+}
+
+TEST(testRingBuffer, iterators) {
+  ring_buffer<int> r;
+  for (int i = 0; i < 6; ++i) r.push_back(i);
+  r.pop_front();
+  r.pop_front();
+  for (int i = 6; i < 10; ++i) r.push_back(i);
+  ASSERT_EQ(r.end() - r.begin(), 8);
+  ASSERT_EQ(r.begin()[3], 5);
+  std::sort(r.begin(), r.end(), std::greater<>());
+  ASSERT_EQ(r.front(), 9);
+  ASSERT_EQ(r.back(), 2);
+  ring_buffer<int>::const_iterator it = r.begin();
+  ASSERT_EQ(*(it + 1), 8);
+  ASSERT_TRUE(it < r.cend());
+}
+
+TEST(testRingBuffer, copyMoveSwap) {
+  ring_buffer<int> a{1, 2, 3};
+  ring_buffer<int> b(a);
+  ASSERT_EQ(std::vector<int>(b.begin(), b.end()), (std::vector<int>{1, 2, 3}));
+  ring_buffer<int> c(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(c.size(), 3U);
+  a = c;
+  ASSERT_EQ(a.back(), 3);
+  a.clear();
+  ASSERT_TRUE(a.empty());
+  a.insert_many_back(7, 8);
+  a.swap(b);
+  ASSERT_EQ(a.size(), 3U);
+  ASSERT_EQ(b.front(), 7);
+  ring_buffer<std::unique_ptr<int>> owners;
+  for (int i = 0; i < 20; ++i) owners.emplace_back(new int(i));
+  ASSERT_EQ(*owners.back(), 19);
+}
@@ -0,0 +1,117 @@
+#include "test_s21_containers.h"
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+namespace simd = s21::simd;
+
+namespace {
+
+template <typename T>
+s21::vector<T> make_sequence(std::size_t n) {
+  s21::vector<T> v;
+  for (std::size_t i = 0; i < n; ++i)
+    v.push_back(static_cast<T>((i * 7919) % 1000) - static_cast<T>(500));
+  return v;
+}
+
+template <typename T>
+void check_against_std(std::size_t n) {
+  auto v = make_sequence<T>(n);
+  const auto &cv = v;
+  std::vector<T> ref(v.begin(), v.end());
+  for (T x : {T(-500), T(0), T(3), T(499), T(777)}) {
+    const auto it = std::find(ref.begin(), ref.end(), x);
+    ASSERT_EQ(simd::find(v, x) - v.begin(), it - ref.begin());
+    ASSERT_EQ(simd::find(cv, x) - cv.begin(), it - ref.begin());
+    ASSERT_EQ(simd::count(v, x),
+              static_cast<std::size_t>(std::count(ref.begin(), ref.end(), x)));
+    ASSERT_EQ(simd::contains(v, x), it != ref.end());
+  }
+  ASSERT_EQ(simd::min_element(v) - v.begin(),
+            std::min_element(ref.begin(), ref.end()) - ref.begin());
+  ASSERT_EQ(simd::max_element(cv) - cv.begin(),
+            std::max_element(ref.begin(), ref.end()) - ref.begin());
+  ASSERT_EQ(simd::accumulate(v, T(1)),
+            std::accumulate(ref.begin(), ref.end(), T(1)));
+}
+
+}  // namespace
+
+TEST(testSimd, int32) {
+  for (std::size_t n : {0, 1, 3, 4, 7, 8, 9, 31, 100, 1001})
+    check_against_std<std::int32_t>(n);
+}
+
+TEST(testSimd, float) {
+  for (std::size_t n : {0, 1, 5, 8, 17, 1000}) check_against_std<float>(n);
+}
+
+TEST(testSimd, double) {
+  for (std::size_t n : {0, 2, 3, 4, 5, 999}) check_against_std<double>(n);
+}
+
+TEST(testSimd, scalarFallback) {
+  check_against_std<long>(333);
+  s21::vector<std::string> v = {"a", "b", "c", "b"};
+  ASSERT_EQ(simd::find(v, std::string("b")) - v.begin(), 1);
+  ASSERT_EQ(simd::count(v, std::string("b")), 2);
+  ASSERT_FALSE(simd::contains(v, std::string("d")));
+  ASSERT_EQ(*simd::max_element(v), "c");
+}
+
+TEST(testSimd, firstOfEqualExtremes) {
+  s21::vector<int> v = {5, 1, 9, 1, 9, 3, 1, 9, 0, 0, 9, 2};
+  ASSERT_EQ(simd::min_element(v) - v.begin(), 8);
+  ASSERT_EQ(simd::max_element(v) - v.begin(), 2);
+}
+
+TEST(testSimd, nan) {
+  s21::vector<double> v = {3.0, 1.0, 2.0, 4.0, 5.0, 0.5, 7.0, 8.0, 9.0};
+  v[4] = std::nan("");
+  std::vector<double> ref(v.begin(), v.end());
+  ASSERT_EQ(simd::min_element(v) - v.begin(),
+            std::min_element(ref.begin(), ref.end()) - ref.begin());
+  ASSERT_EQ(simd::max_element(v) - v.begin(),
+            std::max_element(ref.begin(), ref.end()) - ref.begin());
+  ASSERT_FALSE(simd::contains(v, std::nan("")));
+}
+
+TEST(testSimd, array) {
+  s21::array<float, 11> a = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, -1};
+  ASSERT_EQ(simd::find(a, 9.0f), a.begin() + 8);
+  ASSERT_EQ(simd::min_element(a), a.begin() + 10);
+  ASSERT_EQ(simd::max_element(a), a.begin() + 9);
+  ASSERT_FLOAT_EQ(simd::accumulate(a), 54.0f);
+  ASSERT_EQ(simd::count(a, 4.0f), 1);
+  const s21::array<std::int32_t, 3> ca = {1, 2, 3};
+  ASSERT_TRUE(simd::contains(ca, 3));
+  ASSERT_EQ(simd::find(ca, 7), ca.end());
+}
+
+#ifdef S21_SIMD_X86
+// the dispatcher picks AVX2 on most machines, exercise the SSE2 kernels too
+TEST(testSimd, sse2Kernels) {
+  namespace d = s21::simd::detail;
+  auto v = make_sequence<std::int32_t>(1003);
+  std::vector<std::int32_t> ref(v.begin(), v.end());
+  const std::int32_t *p = v.data();
+  const std::size_t n = v.size();
+  using sse = d::sse2<std::int32_t>;
+  ASSERT_EQ(d::find_kernel<sse>(p, n, 499),
+            std::find(ref.begin(), ref.end(), 499) - ref.begin());
+  ASSERT_EQ(d::count_kernel<sse>(p, n, 0),
+            static_cast<std::size_t>(std::count(ref.begin(), ref.end(), 0)));
+  ASSERT_EQ((d::extreme_kernel<sse, false>(p, n)),
+            std::min_element(ref.begin(), ref.end()) - ref.begin());
+  ASSERT_EQ((d::extreme_kernel<sse, true>(p, n)),
+            std::max_element(ref.begin(), ref.end()) - ref.begin());
+  ASSERT_EQ(d::sum_kernel<sse>(p, n, 0),
+            std::accumulate(ref.begin(), ref.end(), 0));
+  auto f = make_sequence<double>(77);
+  std::vector<double> fref(f.begin(), f.end());
+  ASSERT_EQ((d::extreme_kernel<d::sse2<double>, false>(f.data(), f.size())),
+            std::min_element(fref.begin(), fref.end()) - fref.begin());
+}
+#endif
@@ -0,0 +1,183 @@
+#include "test_s21_containers.h"
+
+#include <numeric>
+#include <string>
+
+namespace {
+
+using particles = s21::soa_vector<int, double, std::string>;
+
+struct counted {
+  static int live;
+  int value;
+  counted(int v) : value(v) { ++live; }
+  counted(const counted &other) : value(other.value) { ++live; }
+  counted(counted &&other) noexcept : value(other.value) { ++live; }
+  ~counted() { --live; }
+};
+int counted::live = 0;
+
+struct throwing_field {
+  static int budget;
+  throwing_field() = default;
+  throwing_field(const throwing_field &) {
+    if (budget-- == 0) throw std::runtime_error("copy");
+  }
+};
+int throwing_field::budget = 0;
+
+}  // namespace
+
+TEST(testSoaVector, empty) {
+  particles p;
+  ASSERT_TRUE(p.empty());
+  ASSERT_EQ(p.size(), 0U);
+  ASSERT_EQ(p.capacity(), 0U);
+  ASSERT_EQ(p.data<0>(), nullptr);
+  ASSERT_TRUE(p.begin() == p.end());
+  ASSERT_THROW(p.pop_back(), std::out_of_range);
+  ASSERT_THROW(p.at(0), std::out_of_range);
+}
+
+TEST(testSoaVector, push_back_and_access) {
+  particles p;
+  for (int i = 0; i < 100; ++i) {
+    if (i % 2)
+      p.push_back(std::make_tuple(i, i * 0.5, std::to_string(i)));
+    else
+      p.emplace_back(i, i * 0.5, std::to_string(i));
+  }
+  ASSERT_EQ(p.size(), 100U);
+  ASSERT_GE(p.capacity(), 100U);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(p.get<0>(i), i);
+    ASSERT_EQ(p.get<1>(i), i * 0.5);
+    ASSERT_EQ(std::get<2>(p[i]), std::to_string(i));
+  }
+  // every column is contiguous
+  for (int i = 0; i < 100; ++i) ASSERT_EQ(p.data<0>()[i], i);
+  std::get<0>(p.at(3)) = -3;
+  ASSERT_EQ(p.get<0>(3), -3);
+  ASSERT_EQ(std::get<0>(p.front()), 0);
+  ASSERT_EQ(std::get<2>(p.back()), "99");
+}
+
+TEST(testSoaVector, self_referencing_emplace) {
+  s21::soa_vector<std::string, int> v;
+  v.emplace_back(std::string(40, 'x'), 1);
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 1U);
+  v.emplace_back(v.get<0>(0), v.get<1>(0) + 1);
+  ASSERT_EQ(v.get<0>(1), std::string(40, 'x'));
+  ASSERT_EQ(v.get<1>(1), 2);
+}
+
+TEST(testSoaVector, columns) {
+  s21::soa_vector<int, float> v{{1, 1.5f}, {2, 2.5f}, {3, 3.5f}};
+  auto ids = v.column<0>();
+  ASSERT_EQ(ids.size(), 3U);
+  ASSERT_EQ(std::accumulate(ids.begin(), ids.end(), 0), 6);
+  for (float &f : v.column<1>()) f *= 2;
+  const auto &cv = v;
+  auto weights = cv.column<1>();
+  ASSERT_EQ(weights[0], 3.0f);
+  ASSERT_EQ(weights.data(), v.data<1>());
+  ASSERT_EQ(*(weights.end() - 1), 7.0f);
+}
+
+TEST(testSoaVector, iterator) {
+  s21::soa_vector<int, char> v;
+  for (int i = 0; i < 10; ++i) v.emplace_back(i, static_cast<char>('a' + i));
+  int expected = 0;
+  for (auto [id, c] : v) {
+    ASSERT_EQ(id, expected);
+    ASSERT_EQ(c, 'a' + expected);
+    c = 'z';
+    ++expected;
+  }
+  ASSERT_EQ(expected, 10);
+  ASSERT_EQ(v.get<1>(4), 'z');
+  auto it = v.begin() + 7;
+  ASSERT_EQ(std::get<0>(*it), 7);
+  ASSERT_EQ(std::get<0>(it[-2]), 5);
+  ASSERT_EQ(v.end() - it, 3);
+  ASSERT_TRUE(v.begin() < it);
+  s21::soa_vector<int, char>::const_iterator cit = it;
+  ASSERT_EQ(std::get<0>(*--cit), 6);
+  ASSERT_EQ(std::distance(v.cbegin(), v.cend()), 10);
+  auto found = std::find_if(v.begin(), v.end(), [](const auto &row) {
+    return std::get<0>(row) == 8;
+  });
+  ASSERT_EQ(found.index(), 8U);
+}
+
+TEST(testSoaVector, copy_move_and_pop) {
+  particles p{{1, 1.0, "one"}, {2, 2.0, "two"}};
+  particles copy(p);
+  ASSERT_EQ(copy.size(), 2U);
+  ASSERT_EQ(copy.get<2>(1), "two");
+  particles moved(std::move(copy));
+  ASSERT_EQ(moved.size(), 2U);
+  ASSERT_TRUE(copy.empty());
+  copy = moved;
+  moved.pop_back();
+  ASSERT_EQ(moved.size(), 1U);
+  ASSERT_EQ(copy.size(), 2U);
+  copy = std::move(moved);
+  ASSERT_EQ(copy.size(), 1U);
+  ASSERT_EQ(copy.get<2>(0), "one");
+  copy.clear();
+  ASSERT_TRUE(copy.empty());
+}
+
+TEST(testSoaVector, growth_policy) {
+  s21::basic_soa_vector<s21::grow_fixed<8>, int, short> v;
+  for (int i = 0; i < 20; ++i) v.emplace_back(i, static_cast<short>(i));
+  ASSERT_EQ(v.capacity(), 27U);  // 9, 18, 27
+  v.reserve(100);
+  ASSERT_EQ(v.capacity(), 100U);
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 20U);
+  ASSERT_EQ(v.get<1>(19), 19);
+  ASSERT_THROW(v.reserve(v.max_size() + 1), std::length_error);
+}
+
+TEST(testSoaVector, destroys_elements) {
+  counted::live = 0;
+  {
+    s21::soa_vector<counted, counted> v;
+    for (int i = 0; i < 33; ++i) v.emplace_back(i, -i);
+    ASSERT_EQ(counted::live, 66);
+    v.pop_back();
+    ASSERT_EQ(counted::live, 64);
+  }
+  ASSERT_EQ(counted::live, 0);
+}
+
+TEST(testSoaVector, construct_rollback) {
+  counted::live = 0;
+  s21::soa_vector<counted, throwing_field> v;
+  v.reserve(4);
+  throwing_field f;
+  throwing_field::budget = 1;
+  v.emplace_back(1, f);
+  ASSERT_THROW(v.emplace_back(2, f), std::runtime_error);
+  ASSERT_EQ(v.size(), 1U);
+  ASSERT_EQ(counted::live, 1);
+}
+
+TEST(testSoaVector, reallocation_rollback) {
+  s21::soa_vector<std::string, throwing_field> v;
+  v.reserve(2);
+  const std::string name(40, 'x');
+  throwing_field f;
+  throwing_field::budget = 2;
+  v.emplace_back(name, f);
+  v.emplace_back(name, f);
+  // copying the second column throws; the strings must not be moved out
+  ASSERT_THROW(v.reserve(8), std::runtime_error);
+  ASSERT_EQ(v.size(), 2U);
+  ASSERT_EQ(v.capacity(), 2U);
+  ASSERT_EQ(v.column<0>()[0], name);
+  ASSERT_EQ(v.column<0>()[1], name);
+}
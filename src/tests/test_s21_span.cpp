@@ -0,0 +1,212 @@
+#include "test_s21_containers.h"
+
+#include <numeric>
+
+TEST(testSpan, empty) {
+  s21::span<int> s;
+  ASSERT_TRUE(s.empty());
+  ASSERT_EQ(s.size(), 0U);
+  ASSERT_EQ(s.data(), nullptr);
+  ASSERT_TRUE(s.begin() == s.end());
+  ASSERT_THROW(s.front(), std::out_of_range);
+  ASSERT_THROW(s.back(), std::out_of_range);
+  ASSERT_THROW(s.at(0), std::out_of_range);
+  ASSERT_EQ(s21::span<int>::extent, s21::dynamic_extent);
+}
+
+TEST(testSpan, fromVector) {
+  s21::vector<int> v = {1, 2, 3, 4, 5};
+  s21::span<int> s(v);
+  ASSERT_EQ(s.data(), v.data());
+  ASSERT_EQ(s.size(), 5U);
+  ASSERT_EQ(s.size_bytes(), 5 * sizeof(int));
+  ASSERT_EQ(s.front(), 1);
+  ASSERT_EQ(s.back(), 5);
+  s[2] = 30;
+  ASSERT_EQ(v[2], 30);
+  ASSERT_THROW(s.at(5), std::out_of_range);
+
+  const s21::vector<int> &cv = v;
+  s21::span<const int> cs(cv);
+  ASSERT_EQ(cs.data(), v.data());
+  ASSERT_FALSE((std::is_constructible_v<s21::span<int>,
+                                        const s21::vector<int> &>));
+  ASSERT_FALSE((std::is_constructible_v<s21::span<double>,
+                                        s21::vector<int> &>));
+}
+
+TEST(testSpan, fromArrayAndPointers) {
+  s21::array<int, 4> a = {1, 2, 3, 4};
+  s21::span<int, 4> fixed(a);
+  ASSERT_EQ(fixed.extent, 4U);
+  ASSERT_EQ(fixed.data(), a.data());
+
+  int raw[3] = {7, 8, 9};
+  s21::span deduced(raw);
+  ASSERT_EQ(deduced.extent, 3U);
+  ASSERT_EQ(deduced.back(), 9);
+
+  s21::span<int> from_count(raw, 2);
+  ASSERT_EQ(from_count.size(), 2U);
+  s21::span<int> from_range(raw + 1, raw + 3);
+  ASSERT_EQ(from_range.size(), 2U);
+  ASSERT_EQ(from_range.front(), 8);
+
+  ASSERT_THROW((s21::span<int, 3>(raw, 2)), std::out_of_range);
+  s21::vector<int> v;
+  v.resize(5);
+  ASSERT_THROW((s21::span<int, 4>(v)), std::out_of_range);
+}
+
+TEST(testSpan, conversions) {
+  s21::vector<int> v = {1, 2, 3};
+  s21::span<int> s(v);
+  s21::span<const int> cs = s;
+  ASSERT_EQ(cs.data(), s.data());
+  s21::span<const int, 3> fixed = s;
+  ASSERT_EQ(fixed.size(), 3U);
+  ASSERT_THROW((s21::span<const int, 2>(s)), std::out_of_range);
+  ASSERT_FALSE((std::is_constructible_v<s21::span<int>,
+                                        s21::span<const int>>));
+}
+
+TEST(testSpan, subviews) {
+  s21::vector<int> v;
+  v.resize(10);
+  std::iota(v.begin(), v.end(), 0);
+  s21::span<int> s(v);
+
+  auto head = s.first(3);
+  ASSERT_EQ(head.size(), 3U);
+  ASSERT_EQ(head.back(), 2);
+  auto tail = s.last(4);
+  ASSERT_EQ(tail.front(), 6);
+  auto mid = s.subspan(2, 5);
+  ASSERT_EQ(mid.front(), 2);
+  ASSERT_EQ(mid.back(), 6);
+  auto rest = s.subspan(7);
+  ASSERT_EQ(rest.size(), 3U);
+  ASSERT_EQ(rest.front(), 7);
+  ASSERT_TRUE(s.subspan(10).empty());
+  ASSERT_TRUE(s.subspan(4, 0).empty());
+
+  ASSERT_THROW(s.first(11), std::out_of_range);
+  ASSERT_THROW(s.last(11), std::out_of_range);
+  ASSERT_THROW(s.subspan(11), std::out_of_range);
+  ASSERT_THROW(s.subspan(8, 3), std::out_of_range);
+
+  auto f2 = s.first<2>();
+  ASSERT_EQ(f2.extent, 2U);
+  ASSERT_EQ(f2[1], 1);
+  auto l2 = s.last<2>();
+  ASSERT_EQ(l2[0], 8);
+  auto sub = s.subspan<3, 4>();
+  ASSERT_EQ(sub.extent, 4U);
+  ASSERT_EQ(sub.front(), 3);
+  ASSERT_EQ(s.subspan<3>().size(), 7U);
+  ASSERT_EQ(s.subspan<3>().extent, s21::dynamic_extent);
+
+  s21::array<int, 6> a = {0, 1, 2, 3, 4, 5};
+  s21::span<int, 6> fixed(a);
+  ASSERT_EQ(fixed.subspan<2>().extent, 4U);
+  ASSERT_EQ(fixed.subspan<2>().front(), 2);
+}
+
+TEST(testSpan, iterators) {
+  s21::vector<int> v;
+  v.resize(100);
+  std::iota(v.begin(), v.end(), 1);
+  s21::span<int> s = s21::span<int>(v).subspan(10, 10);
+  ASSERT_EQ(std::accumulate(s.begin(), s.end(), 0), 155);
+  ASSERT_EQ(s.end() - s.begin(), 10);
+  for (int &x : s) x = 0;
+  ASSERT_EQ(std::accumulate(v.begin(), v.end(), 0), 5050 - 155);
+
+  s21::span<const int> cs = s;
+  static_assert(std::is_same_v<decltype(*cs.begin()), const int &>);
+  std::sort(s21::span<int>(v).begin(), s21::span<int>(v).end());
+  ASSERT_EQ(v[0], 0);
+}
+
+TEST(testStridedSpan, column) {
+  // 3 x 4 row-major matrix
+  s21::vector<int> m;
+  m.resize(12);
+  std::iota(m.begin(), m.end(), 0);
+  s21::strided_span<int> col(m.data() + 1, 3, 4);
+  ASSERT_EQ(col.size(), 3U);
+  ASSERT_EQ(col.stride(), 4);
+  ASSERT_EQ(col[0], 1);
+  ASSERT_EQ(col[2], 9);
+  ASSERT_EQ(col.at(1), 5);
+  ASSERT_THROW(col.at(3), std::out_of_range);
+  col[1] = 50;
+  ASSERT_EQ(m[5], 50);
+
+  int sum = 0;
+  for (int x : col) sum += x;
+  ASSERT_EQ(sum, 1 + 50 + 9);
+  ASSERT_EQ(col.end() - col.begin(), 3);
+  ASSERT_EQ(col.begin()[2], 9);
+  ASSERT_THROW((s21::strided_span<int>(m.data(), 3, 0)),
+               std::invalid_argument);
+}
+
+TEST(testStridedSpan, fromSpan) {
+  s21::vector<int> v;
+  v.resize(10);
+  std::iota(v.begin(), v.end(), 0);
+  s21::span<const int> s(v);
+  auto even = s.stride(2);
+  ASSERT_EQ(even.size(), 5U);
+  ASSERT_EQ(even[4], 8);
+  auto third = s.stride(3);
+  ASSERT_EQ(third.size(), 4U);
+  ASSERT_EQ(third[3], 9);
+  auto sub = third.subspan(1, 2);
+  ASSERT_EQ(sub[0], 3);
+  ASSERT_EQ(sub[1], 6);
+  ASSERT_THROW(third.subspan(2, 3), std::out_of_range);
+  ASSERT_EQ(third.subspan(4).size(), 0U);
+
+  s21::strided_span<const int> backwards(v.data() + 9, 10, -1);
+  ASSERT_EQ(backwards[0], 9);
+  ASSERT_EQ(backwards[9], 0);
+  ASSERT_TRUE(std::is_sorted(backwards.begin(), backwards.end(),
+                             [](int a, int b) { return a > b; }));
+}
+
+TEST(testStridedSpan, iteratorsStayInRange) {
+  s21::vector<int> v;
+  v.resize(10);
+  std::iota(v.begin(), v.end(), 0);
+  // 10 is not a multiple of 3: end() would lie two elements past the array
+  auto third = s21::span<int>(v).stride(3);
+  ASSERT_EQ(std::vector<int>(third.begin(), third.end()),
+            (std::vector<int>{0, 3, 6, 9}));
+  ASSERT_EQ(std::vector<int>(std::make_reverse_iterator(third.end()),
+                             std::make_reverse_iterator(third.begin())),
+            (std::vector<int>{9, 6, 3, 0}));
+  ASSERT_EQ(third.end() - third.begin(), 4);
+  ASSERT_TRUE(third.begin() + 4 == third.end());
+  ASSERT_TRUE(third.begin() < third.end());
+  auto tail = third.subspan(4);
+  ASSERT_TRUE(tail.begin() == tail.end());
+  ASSERT_EQ(tail.data(), third.data());
+
+  s21::strided_span<int> backwards(v.data() + 9, 5, -2);
+  ASSERT_EQ(std::vector<int>(backwards.begin(), backwards.end()),
+            (std::vector<int>{9, 7, 5, 3, 1}));
+  ASSERT_TRUE(backwards.begin() < backwards.end());
+  ASSERT_EQ(*(backwards.end() - 1), 1);
+}
+
+TEST(testStridedSpan, sortColumn) {
+  s21::vector<int> m = {3, 0, 1, 0, 2, 0};
+  s21::strided_span<int> col(m.data(), 3, 2);
+  std::sort(col.begin(), col.end());
+  ASSERT_EQ(m[0], 1);
+  ASSERT_EQ(m[2], 2);
+  ASSERT_EQ(m[4], 3);
+  ASSERT_EQ(m[1], 0);
+}
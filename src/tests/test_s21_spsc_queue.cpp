@@ -0,0 +1,100 @@
+#include "test_s21_containers.h"
+
+#include <iterator>
+#include <thread>
+
+using s21::spsc_queue;
+
+TEST(testSpscQueue, boundsAndOrder) {
+  spsc_queue<int> q(5);
+  ASSERT_EQ(q.capacity(), 5U);
+  ASSERT_TRUE(q.empty());
+  for (int i = 0; i < 5; ++i) ASSERT_TRUE(q.try_push(i));
+  ASSERT_FALSE(q.try_push(5));
+  ASSERT_EQ(q.size(), 5U);
+  int out = -1;
+  for (int round = 0; round < 100; ++round) {
+    ASSERT_TRUE(q.try_pop(out));
+    ASSERT_EQ(out, round);
+    ASSERT_TRUE(q.try_push(round + 5));
+    ASSERT_FALSE(q.try_push(0));
+  }
+  while (q.try_pop(out)) {
+  }
+  ASSERT_EQ(out, 104);
+  ASSERT_EQ(q.front(), nullptr);
+  ASSERT_THROW(spsc_queue<int>(0), std::length_error);
+}
+
+TEST(testSpscQueue, moveOnly) {
+  spsc_queue<std::unique_ptr<int>> q(4);
+  ASSERT_TRUE(q.try_push(std::make_unique<int>(1)));
+  ASSERT_TRUE(q.try_emplace(new int(2)));
+  std::unique_ptr<int> out;
+  ASSERT_TRUE(q.try_pop(out));
+  ASSERT_EQ(*out, 1);
+  ASSERT_EQ(**q.front(), 2);
+  q.pop();
+  ASSERT_TRUE(q.empty());
+}
+
+TEST(testSpscQueue, bulk) {
+  spsc_queue<std::string> q(6);
+  std::vector<std::string> in{"a", "b", "c", "d", "e", "f", "g", "h"};
+  ASSERT_EQ(q.push_bulk(std::make_move_iterator(in.begin()), in.size()), 6U);
+  ASSERT_TRUE(in[0].empty());
+  ASSERT_EQ(in[6], "g");
+  std::vector<std::string> out;
+  ASSERT_EQ(q.pop_bulk(std::back_inserter(out), 4), 4U);
+  ASSERT_EQ(q.push_bulk(in.begin() + 6, 2), 2U);
+  ASSERT_EQ(q.pop_bulk(std::back_inserter(out), 100), 4U);
+  ASSERT_EQ(out, (std::vector<std::string>{"a", "b", "c", "d", "e", "f", "g",
+                                           "h"}));
+  ASSERT_EQ(q.pop_bulk(std::back_inserter(out), 1), 0U);
+}
+
+TEST(testSpscQueue, destroysLeftovers) {
+  auto counter = std::make_shared<int>(0);
+  {
+    spsc_queue<std::shared_ptr<int>> q(8);
+    for (int i = 0; i < 6; ++i) q.try_push(counter);
+    std::shared_ptr<int> out;
+    q.try_pop(out);
+    ASSERT_EQ(counter.use_count(), 7);
+  }
+  ASSERT_EQ(counter.use_count(), 1);
+}
+
+TEST(testSpscQueue, twoThreads) {
+  constexpr int kItems = 200000;
+  spsc_queue<int> q(64);
+  std::thread producer([&] {
+    int batch[7];
+    for (int i = 0; i < kItems;) {
+      if (i % 3 == 0) {
+        const int n = std::min(7, kItems - i);
+        for (int k = 0; k < n; ++k) batch[k] = i + k;
+        i += static_cast<int>(q.push_bulk(batch, n));
+      } else if (q.try_push(i)) {
+        ++i;
+      }
+      if (q.size() == q.capacity()) std::this_thread::yield();
+    }
+  });
+  long long sum = 0;
+  int expected = 0;
+  bool ordered = true;
+  int buffer[16];
+  while (expected < kItems) {
+    const std::size_t n = q.pop_bulk(buffer, 16);
+    for (std::size_t k = 0; k < n; ++k) {
+      ordered &= buffer[k] == expected++;
+      sum += buffer[k];
+    }
+    if (n == 0) std::this_thread::yield();
+  }
+  producer.join();
+  ASSERT_TRUE(ordered);
+  ASSERT_EQ(sum, 1LL * kItems * (kItems - 1) / 2);
+  ASSERT_TRUE(q.empty());
+}
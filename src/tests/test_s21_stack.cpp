@@ -125,4 +125,39 @@ TEST(testStack, insert_many_back) {
   s.pop();
   s.pop();
   EXPECT_EQ(s.top(), 1345);
-}
\ No newline at end of file
+}
+TEST(testStack, otherContainers) {
+  stack<int, s21::list<int>> by_list{1, 2, 3};
+  stack<int, s21::deque<int>> by_deque{1, 2, 3};
+  stack<int, s21::unrolled_list<int>> by_chunks{1, 2, 3};
+  by_list.insert_many_back(0, -1);
+  by_deque.insert_many_back(0, -1);
+  by_chunks.insert_many_back(0, -1);
+  const std::vector<int> expected{-1, 0, 1, 2, 3};
+  ASSERT_EQ(std::vector<int>(by_list.begin(), by_list.end()), expected);
+  ASSERT_EQ(std::vector<int>(by_deque.begin(), by_deque.end()), expected);
+  ASSERT_EQ(std::vector<int>(by_chunks.begin(), by_chunks.end()), expected);
+  for (int i = 3; i >= -1; --i) {
+    ASSERT_EQ(by_list.top(), i);
+    ASSERT_EQ(by_chunks.top(), i);
+    by_list.pop();
+    by_chunks.pop();
+  }
+  ASSERT_TRUE(by_list.empty());
+  ASSERT_THROW(by_chunks.top(), std::out_of_range);
+}
+
+TEST(testStack, emplaceAndIterators) {
+  stack<std::unique_ptr<int>> s;
+  s.push(std::make_unique<int>(1));
+  *s.emplace(new int(2)) += 10;
+  ASSERT_EQ(*s.top(), 12);
+  int expected = 1;
+  for (const auto &p : s) {
+    ASSERT_EQ(*p, expected);
+    expected += 11;
+  }
+  const stack<int> cs(s21::vector<int>{4, 5});
+  ASSERT_EQ(cs.top(), 5);
+  ASSERT_EQ(*cs.begin(), 4);
+}
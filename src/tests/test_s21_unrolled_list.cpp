@@ -0,0 +1,216 @@
+#include "test_s21_containers.h"
+
+#include <list>
+#include <numeric>
+#include <string>
+
+namespace {
+
+// small chunks so that splits and merges happen in short tests
+using small_list = s21::unrolled_list<int, 4>;
+
+template <typename L>
+std::vector<typename L::value_type> contents(const L &l) {
+  std::vector<typename L::value_type> forward(l.begin(), l.end());
+  std::vector<typename L::value_type> backward;
+  for (auto it = l.end(); it != l.begin();) backward.push_back(*--it);
+  std::reverse(backward.begin(), backward.end());
+  EXPECT_EQ(forward, backward);
+  EXPECT_EQ(forward.size(), l.size());
+  return forward;
+}
+
+}  // namespace
+
+TEST(testUnrolledList, empty) {
+  small_list l;
+  ASSERT_TRUE(l.empty());
+  ASSERT_EQ(l.size(), 0U);
+  ASSERT_EQ(l.chunk_count(), 0U);
+  ASSERT_TRUE(l.begin() == l.end());
+  ASSERT_THROW(l.front(), std::out_of_range);
+  ASSERT_THROW(l.back(), std::out_of_range);
+  ASSERT_THROW(l.pop_back(), std::out_of_range);
+  ASSERT_THROW(l.pop_front(), std::out_of_range);
+}
+
+TEST(testUnrolledList, pushBothEnds) {
+  small_list l;
+  for (int i = 0; i < 10; ++i) l.push_back(i);
+  for (int i = -1; i > -10; --i) l.push_front(i);
+  std::vector<int> expected(19);
+  std::iota(expected.begin(), expected.end(), -9);
+  ASSERT_EQ(contents(l), expected);
+  ASSERT_EQ(l.front(), -9);
+  ASSERT_EQ(l.back(), 9);
+  // pushes at the ends fill whole chunks
+  ASSERT_LE(l.chunk_count(), 6U);
+  while (!l.empty()) {
+    l.pop_front();
+    if (!l.empty()) l.pop_back();
+  }
+  ASSERT_EQ(l.chunk_count(), 0U);
+}
+
+TEST(testUnrolledList, insertEraseMatchesStdList) {
+  small_list l;
+  std::list<int> ref;
+  unsigned x = 7;
+  for (int step = 0; step < 3000; ++step) {
+    x = x * 1103515245 + 12345;
+    const std::size_t at = ref.empty() ? 0 : (x >> 8) % (ref.size() + 1);
+    auto it = l.begin();
+    auto rit = ref.begin();
+    for (std::size_t i = 0; i < at; ++i, ++it, ++rit) {
+    }
+    if ((x >> 4) % 3 != 0 || ref.empty() || rit == ref.end()) {
+      auto ins = l.insert(it, step);
+      ASSERT_EQ(*ins, step);
+      ref.insert(rit, step);
+    } else {
+      auto next = l.erase(it);
+      auto rnext = ref.erase(rit);
+      ASSERT_EQ(next == l.end(), rnext == ref.end());
+      if (rnext != ref.end()) {
+        ASSERT_EQ(*next, *rnext);
+      }
+    }
+  }
+  ASSERT_EQ(contents(l), std::vector<int>(ref.begin(), ref.end()));
+  // chunks stay reasonably full
+  ASSERT_LE(l.chunk_count() * 4, l.size() * 4 / 3 * 2 + 8);
+}
+
+TEST(testUnrolledList, insertAliasing) {
+  small_list l{1, 2, 3, 4};
+  l.insert(++l.cbegin(), l.back());
+  ASSERT_EQ(contents(l), (std::vector<int>{1, 4, 2, 3, 4}));
+  l.insert(l.cbegin(), *++l.begin());
+  ASSERT_EQ(contents(l), (std::vector<int>{4, 1, 4, 2, 3, 4}));
+}
+
+TEST(testUnrolledList, eraseRange) {
+  small_list l;
+  for (int i = 0; i < 20; ++i) l.push_back(i);
+  auto first = l.cbegin();
+  for (int i = 0; i < 3; ++i) ++first;
+  auto last = first;
+  for (int i = 0; i < 10; ++i) ++last;
+  auto it = l.erase(first, last);
+  ASSERT_EQ(*it, 13);
+  ASSERT_EQ(l.size(), 10U);
+  it = l.erase(++l.cbegin(), l.cend());
+  ASSERT_TRUE(it == l.end());
+  ASSERT_EQ(contents(l), std::vector<int>{0});
+}
+
+TEST(testUnrolledList, copyAndMove) {
+  s21::unrolled_list<std::string> a{"one", "two", "three"};
+  s21::unrolled_list<std::string> b(a);
+  ASSERT_EQ(contents(b), contents(a));
+  const std::string *first = &*a.begin();
+  s21::unrolled_list<std::string> c(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(&*c.begin(), first);
+  a = c;
+  ASSERT_EQ(a.back(), "three");
+  b = std::move(c);
+  ASSERT_EQ(b.size(), 3U);
+  s21::unrolled_list<std::string> e;
+  a.swap(e);
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(e.size(), 3U);
+}
+
+TEST(testUnrolledList, emplaceMoveOnly) {
+  s21::unrolled_list<std::unique_ptr<int>, 4> l;
+  for (int i = 0; i < 10; ++i) l.emplace_back(new int(i));
+  l.emplace_front(new int(-1));
+  l.emplace(++l.cbegin(), new int(100));
+  ASSERT_EQ(*l.front(), -1);
+  ASSERT_EQ(**++l.begin(), 100);
+  ASSERT_EQ(*l.back(), 9);
+  ASSERT_EQ(l.size(), 12U);
+}
+
+TEST(testUnrolledList, splice) {
+  small_list a{1, 2, 3, 4, 5, 6};
+  small_list b{10, 20, 30};
+  auto pos = a.cbegin();
+  ++pos;
+  ++pos;
+  a.splice(pos, b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(contents(a), (std::vector<int>{1, 2, 10, 20, 30, 3, 4, 5, 6}));
+  small_list c{7, 8};
+  a.splice(a.cend(), c);
+  small_list d{0};
+  a.splice(a.cbegin(), d);
+  ASSERT_EQ(contents(a),
+            (std::vector<int>{0, 1, 2, 10, 20, 30, 3, 4, 5, 6, 7, 8}));
+  b.push_back(99);
+  ASSERT_EQ(contents(b), std::vector<int>{99});
+}
+
+TEST(testUnrolledList, mergeSortUniqueReverse) {
+  small_list a{1, 3, 5, 7, 9};
+  small_list b{2, 3, 4, 10};
+  a.merge(b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(contents(a), (std::vector<int>{1, 2, 3, 3, 4, 5, 7, 9, 10}));
+  a.unique();
+  ASSERT_EQ(contents(a), (std::vector<int>{1, 2, 3, 4, 5, 7, 9, 10}));
+  a.reverse();
+  ASSERT_EQ(contents(a), (std::vector<int>{10, 9, 7, 5, 4, 3, 2, 1}));
+  a.sort();
+  ASSERT_EQ(contents(a), (std::vector<int>{1, 2, 3, 4, 5, 7, 9, 10}));
+
+  s21::unrolled_list<std::pair<int, int>, 4> pairs;
+  for (int i = 0; i < 50; ++i) pairs.push_back({i % 3, i});
+  pairs.sort([](const auto &l, const auto &r) { return l.first < r.first; });
+  auto v = contents(pairs);
+  for (std::size_t i = 1; i < v.size(); ++i) {
+    if (v[i - 1].first == v[i].first) {
+      ASSERT_LT(v[i - 1].second, v[i].second);
+    }
+  }
+}
+
+TEST(testUnrolledList, insertMany) {
+  small_list l{1, 9};
+  auto it = l.insert_many(++l.cbegin(), 2, 3, 4, 5, 6);
+  ASSERT_EQ(*it, 6);
+  l.insert_many_back(10, 11);
+  l.insert_many_front(-1, 0);
+  ASSERT_EQ(contents(l),
+            (std::vector<int>{-1, 0, 1, 2, 3, 4, 5, 6, 9, 10, 11}));
+}
+
+TEST(testUnrolledList, mergeKeepsAllocator) {
+  using tracked = s21::unrolled_list<int, 4, s21::tracking_allocator<int>>;
+  auto stats = std::make_shared<s21::allocation_stats>();
+  s21::tracking_allocator<int> alloc(stats);
+  tracked a(alloc), b(alloc);
+  for (int i : {1, 3, 5}) a.push_back(i);
+  b.push_back(2);
+  for (int i = 10; i < 30; ++i) b.push_back(i);
+  const std::size_t allocations = stats->allocations();
+  a.merge(b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(&a.get_allocator().stats(), stats.get());
+  // 2 fits into a's chunk and b's tail chunks are relinked, not copied
+  ASSERT_EQ(stats->allocations(), allocations);
+  std::vector<int> expected{1, 2, 3, 5};
+  for (int i = 10; i < 30; ++i) expected.push_back(i);
+  ASSERT_EQ(contents(a), expected);
+
+  // unequal allocators: the elements move, each list keeps its own stats
+  tracked c, d;
+  for (int i : {2, 4}) c.push_back(i);
+  for (int i : {1, 3, 5, 6, 7, 8}) d.push_back(i);
+  const s21::allocation_stats *c_stats = &c.get_allocator().stats();
+  c.merge(d);
+  ASSERT_EQ(&c.get_allocator().stats(), c_stats);
+  ASSERT_EQ(d.get_allocator().stats().live_bytes(), 0U);
+  ASSERT_EQ(contents(c), (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+}
@@ -269,5 +269,326 @@ TEST(testVector, vector_of_vectors) {
   ASSERT_EQ(v.size(), 6);
 }
 
+TEST(testVector, growth_policies) {
+  vector<int, std::allocator<int>, s21::grow_one_and_half> v15 = {1, 2, 3, 4};
+  ASSERT_EQ(v15.capacity(), 6);
+  vector<int, std::allocator<int>, s21::grow_fixed<8>> vf;
+  vf.push_back(1);
+  ASSERT_EQ(vf.capacity(), 9);
+  vector<int, std::allocator<int>, s21::grow_exact> ve;
+  for (int i = 0; i < 5; ++i) {
+    ve.push_back(i);
+    ASSERT_EQ(ve.capacity(), ve.size());
+  }
+  ASSERT_EQ(ve[4], 4);
+}
+
+TEST(testVector, growth_runtime) {
+  vector<int, std::allocator<int>, s21::grow_runtime> v;
+  v.set_growth_policy({1, 1, 100});
+  v.push_back(1);
+  ASSERT_EQ(v.capacity(), 101);
+  v.set_growth_policy({3, 2, 0});
+  v.reserve(0);
+  v.shrink_to_fit();
+  v.insert_many_back(2, 3, 4);
+  ASSERT_EQ(v.capacity(), 6);
+  ASSERT_EQ(v.growth_policy().num, 3);
+  ASSERT_EQ(v[3], 4);
+}
+
+TEST(testVector, growthRuntimeZeroFactor) {
+  vector<int, std::allocator<int>, s21::grow_runtime> v;
+  // a zero factor falls back to the required size, like a zero divisor
+  v.set_growth_policy({0, 1, 0});
+  v.push_back(1);
+  v.push_back(2);
+  ASSERT_EQ(v.capacity(), 2);
+  v.set_growth_policy({0, 0, 3});
+  v.push_back(3);
+  ASSERT_EQ(v.capacity(), 6);
+  ASSERT_EQ(v[2], 3);
+}
+
+TEST(testVector, mmap_allocator) {
+  using alloc = s21::mmap_allocator<int, 4096>;
+  vector<int, alloc, s21::grow_fixed<1000>> v;
+  for (int i = 0; i < 100000; ++i) v.push_back(i);
+  ASSERT_EQ(v.size(), 100000);
+  for (int i = 0; i < 100000; ++i) ASSERT_EQ(v[i], i);
+  v.insert(v.begin() + 1, -1);
+  ASSERT_EQ(v[0], 0);
+  ASSERT_EQ(v[1], -1);
+  ASSERT_EQ(v[2], 1);
+  ASSERT_EQ(v.back(), 99999);
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 100001);
+  ASSERT_EQ(v[50000], 49999);
+  v.erase(v.begin() + 1);
+  vector<int, alloc, s21::grow_fixed<1000>> small = {1, 2, 3};
+  small.swap(v);
+  ASSERT_EQ(small[99999], 99999);
+  ASSERT_EQ(v.size(), 3);
+}
+
+TEST(testVector, insert_range) {
+  vector<int> v = {1, 2, 3};
+  std::vector<int> src(1000);
+  for (int i = 0; i < 1000; ++i) src[i] = i + 10;
+  auto it = v.insert(v.cbegin() + 1, src.begin(), src.end());
+  ASSERT_EQ(it - v.begin(), 1);
+  ASSERT_EQ(v.size(), 1003);
+  // one reallocation straight to the policy's capacity
+  ASSERT_EQ(v.capacity(), 2006);
+  ASSERT_EQ(v[0], 1);
+  ASSERT_EQ(v[1], 10);
+  ASSERT_EQ(v[1000], 1009);
+  ASSERT_EQ(v[1001], 2);
+  ASSERT_EQ(v[1002], 3);
+  s21::list<int> l = {-1, -2};
+  v.insert(v.cend(), l.begin(), l.end());
+  ASSERT_EQ(v.back(), -2);
+  std::istringstream in("7 8 9");
+  v.insert(v.cbegin(), std::istream_iterator<int>(in),
+           std::istream_iterator<int>());
+  ASSERT_EQ(v[0], 7);
+  ASSERT_EQ(v[2], 9);
+  ASSERT_EQ(v[3], 1);
+  v.insert(v.cbegin() + 2, {100, 200});
+  ASSERT_EQ(v[2], 100);
+  ASSERT_EQ(v[4], 9);
+}
+
+TEST(testVector, insert_count_and_emplace) {
+  vector<std::string> v = {"a", "b", "c"};
+  v.insert(v.cbegin() + 1, 3, std::string("x"));
+  ASSERT_EQ(v.size(), 6);
+  ASSERT_EQ(v[1], "x");
+  ASSERT_EQ(v[3], "x");
+  ASSERT_EQ(v[4], "b");
+  v.insert(v.cbegin(), 2, v[5]);
+  ASSERT_EQ(v[0], "c");
+  ASSERT_EQ(v[1], "c");
+  v.emplace(v.cbegin() + 1, 3, 'z');
+  ASSERT_EQ(v[1], "zzz");
+  v.emplace(v.cbegin() + 1, v[0]);
+  ASSERT_EQ(v[1], "c");
+  ASSERT_EQ(v.size(), 10);
+  ASSERT_EQ(v.back(), "c");
+  v.emplace_back(2, 'q');
+  ASSERT_EQ(v.back(), "qq");
+}
+
+TEST(testVector, push_back_alias) {
+  vector<std::string> v = {"first"};
+  v.shrink_to_fit();
+  for (int i = 0; i < 5; ++i) v.push_back(v[0]);
+  for (int i = 0; i < 6; ++i) ASSERT_EQ(v[i], "first");
+  v.insert_many(v.cbegin(), v[5], v[0]);
+  ASSERT_EQ(v.size(), 8);
+  ASSERT_EQ(v[0], "first");
+  ASSERT_EQ(v[1], "first");
+}
+
+TEST(testVector, append_range_and_assign) {
+  vector<double> v;
+  s21::array<double, 4> a = {1.5, 2.5, 3.5, 4.5};
+  v.append_range(a);
+  v.append_range(std::vector<double>{5.5});
+  ASSERT_EQ(v.size(), 5);
+  ASSERT_DOUBLE_EQ(v[4], 5.5);
+  v.assign(3, 0.5);
+  ASSERT_EQ(v.size(), 3);
+  ASSERT_DOUBLE_EQ(v[2], 0.5);
+  v.assign({9.0, 8.0});
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_DOUBLE_EQ(v[1], 8.0);
+  vector<double> big;
+  big.assign(a.begin(), a.end());
+  ASSERT_EQ(big.capacity(), 4);
+  ASSERT_DOUBLE_EQ(big[3], 4.5);
+}
+
+TEST(testVector, resize) {
+  vector<std::string> v = {"a"};
+  v.resize(4);
+  ASSERT_EQ(v.size(), 4);
+  ASSERT_EQ(v[0], "a");
+  ASSERT_EQ(v[3], "");
+  v.resize(6, "b");
+  ASSERT_EQ(v[5], "b");
+  v.resize(2);
+  ASSERT_EQ(v.size(), 2);
+  v.resize(3, v[0]);
+  ASSERT_EQ(v[2], "a");
+  vector<int> empty;
+  empty.resize(1000);
+  ASSERT_EQ(empty.capacity(), 1000);
+  ASSERT_EQ(empty[999], 0);
+}
+
+TEST(testVector, resize_default_init) {
+  vector<char> buf;
+  buf.resize_default_init(4096);
+  ASSERT_EQ(buf.size(), 4096);
+  std::memset(buf.data(), 'x', buf.size());
+  buf.resize_default_init(10);
+  ASSERT_EQ(buf.size(), 10);
+  ASSERT_EQ(buf[9], 'x');
+  vector<std::string> strings;
+  strings.resize_default_init(2);
+  ASSERT_EQ(strings[1], "");
+}
+
+namespace {
+struct throwing_copy {
+  static int budget;
+  int value;
+  throwing_copy(int v) : value(v) {}
+  throwing_copy(const throwing_copy &other) : value(other.value) {
+    if (--budget < 0) throw std::runtime_error("copy");
+  }
+  throwing_copy(throwing_copy &&) noexcept = default;
+  throwing_copy &operator=(const throwing_copy &) = default;
+  throwing_copy &operator=(throwing_copy &&) noexcept = default;
+};
+int throwing_copy::budget = 0;
+
+// copied on reallocation, its move constructor not being noexcept
+struct fragile_copy {
+  static int budget;
+  std::string value;
+  fragile_copy(int v) : value(std::to_string(v)) {}
+  fragile_copy(const fragile_copy &other) : value(other.value) {
+    if (--budget < 0) throw std::runtime_error("copy");
+  }
+  fragile_copy(fragile_copy &&other) : value(std::move(other.value)) {}
+  fragile_copy &operator=(const fragile_copy &) = default;
+  fragile_copy &operator=(fragile_copy &&) = default;
+};
+int fragile_copy::budget = 0;
+
+void expect_untouched(const vector<fragile_copy> &v, std::size_t cap) {
+  ASSERT_EQ(v.size(), 4);
+  ASSERT_EQ(v.capacity(), cap);
+  for (int i = 0; i < 4; ++i) ASSERT_EQ(v[i].value, std::to_string(i));
+}
+}  // namespace
+
+TEST(testVector, reallocation_rollback) {
+  vector<fragile_copy> v;
+  v.reserve(4);
+  for (int i = 0; i < 4; ++i) v.emplace_back(i);
+  fragile_copy::budget = 2;
+  ASSERT_THROW(v.reserve(10), std::runtime_error);
+  expect_untouched(v, 4);
+  fragile_copy::budget = 100;
+  v.reserve(10);
+  fragile_copy::budget = 3;
+  ASSERT_THROW(v.shrink_to_fit(), std::runtime_error);
+  expect_untouched(v, 10);
+}
+
+TEST(testVector, insert_reallocation_rollback) {
+  vector<fragile_copy> v;
+  v.reserve(4);
+  for (int i = 0; i < 4; ++i) v.emplace_back(i);
+  const fragile_copy extra(9);
+  // the new element is copied, then the old ones until the budget runs out
+  fragile_copy::budget = 3;
+  ASSERT_THROW(v.insert(v.cbegin() + 1, extra), std::runtime_error);
+  expect_untouched(v, 4);
+  fragile_copy::budget = 3;
+  ASSERT_THROW(v.push_back(extra), std::runtime_error);
+  expect_untouched(v, 4);
+  fragile_copy::budget = 3;
+  ASSERT_THROW(v.insert_many(v.cbegin() + 2, extra), std::runtime_error);
+  expect_untouched(v, 4);
+  fragile_copy::budget = 3;
+  ASSERT_THROW(v.resize(6, extra), std::runtime_error);
+  expect_untouched(v, 4);
+  fragile_copy::budget = 100;
+  v.insert(v.cbegin() + 1, extra);
+  ASSERT_EQ(v.size(), 5);
+  ASSERT_EQ(v[1].value, "9");
+  ASSERT_EQ(v[4].value, "3");
+}
+
+TEST(testVector, insert_range_rollback) {
+  vector<throwing_copy> v;
+  for (int i = 0; i < 5; ++i) v.emplace_back(i);
+  throwing_copy::budget = 100;
+  std::vector<throwing_copy> src = {10, 11, 12};
+  throwing_copy::budget = 2;
+  ASSERT_THROW(v.insert(v.cbegin() + 2, src.begin(), src.end()),
+               std::runtime_error);
+  ASSERT_EQ(v.size(), 5);
+  for (int i = 0; i < 5; ++i) ASSERT_EQ(v[i].value, i);
+}
+
+TEST(testVector, erase_range) {
+  vector<std::string> v = {"0", "1", "2", "3", "4", "5"};
+  auto it = v.erase(v.cbegin() + 1, v.cbegin() + 4);
+  ASSERT_EQ(*it, "4");
+  ASSERT_EQ(v.size(), 3);
+  ASSERT_EQ(v[0], "0");
+  ASSERT_EQ(v[2], "5");
+  it = v.erase(v.cbegin() + 1, v.cbegin() + 1);
+  ASSERT_EQ(v.size(), 3);
+  it = v.erase(v.cbegin(), v.cend());
+  ASSERT_EQ(it, v.end());
+  ASSERT_TRUE(v.empty());
+  ASSERT_THROW(v.erase(v.cbegin(), v.cend() + 1), std::out_of_range);
+  vector<int> ints = {1, 2, 3, 4};
+  ASSERT_EQ(*ints.erase(ints.cbegin()), 2);
+  ints.erase(ints.cbegin() + 1, ints.cend());
+  ASSERT_EQ(ints.size(), 1);
+  ASSERT_EQ(ints[0], 2);
+}
+
+TEST(testVector, erase_if) {
+  vector<int> v;
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  ASSERT_EQ(v.erase_if([](int x) { return x % 3 == 0; }), 34);
+  ASSERT_EQ(v.size(), 66);
+  ASSERT_EQ(v[0], 1);
+  ASSERT_EQ(v[1], 2);
+  ASSERT_EQ(v[2], 4);
+  ASSERT_EQ(v.back(), 98);
+  ASSERT_EQ(s21::erase(v, 4), 1);
+  ASSERT_EQ(v[2], 5);
+  vector<std::string> s = {"a", "bb", "c", "dd"};
+  ASSERT_EQ(s21::erase_if(s, [](const std::string &x) { return x.size() > 1; }),
+            2);
+  ASSERT_EQ(s.size(), 2);
+  ASSERT_EQ(s[1], "c");
+}
+
+TEST(testVector, erase_if_throwing_predicate) {
+  vector<std::string> v = {"a", "x", "b", "x", "!", "c", "x"};
+  ASSERT_THROW(v.erase_if([](const std::string &x) {
+    if (x == "!") throw std::runtime_error("predicate");
+    return x == "x";
+  }),
+               std::runtime_error);
+  ASSERT_EQ(v.size(), 5);
+  ASSERT_EQ(v[0], "a");
+  ASSERT_EQ(v[1], "b");
+  ASSERT_EQ(v[2], "!");
+  ASSERT_EQ(v[4], "x");
+}
+
+TEST(testVector, unordered_erase) {
+  vector<int> v = {1, 2, 3, 4, 5};
+  auto it = v.unordered_erase(v.cbegin() + 1);
+  ASSERT_EQ(*it, 5);
+  ASSERT_EQ(v.size(), 4);
+  ASSERT_EQ(v[3], 4);
+  v.unordered_erase(v.cend() - 1);
+  ASSERT_EQ(v.size(), 3);
+  ASSERT_EQ(v.back(), 3);
+  ASSERT_THROW(v.unordered_erase(v.cend()), std::out_of_range);
+}
+
 // Empty function to "group" vector tests
 void AddVectorTests() {}